@@ -0,0 +1,227 @@
+/**
+ * @file CacheModel.cpp
+ * 
+ * @brief Implementation file for CacheModel class
+ * 
+ * @details Implements all member methods of CacheModel class. Addresses map
+ *          to sets by line number modulo the number of sets; the random
+ *          replacement policy draws from a xorshift generator kept with the
+ *          cache state, so runs and checkpoints stay reproducible.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of CacheModel class
+ * 
+ * @note Requries CacheModel.h
+ */
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "CacheModel.h"
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs a hierarchy with no levels and 64-byte LRU lines.
+ */
+CacheModel::CacheModel() :
+    lineSize(DEFAULT_CACHE_LINE),
+    policy(CACHE_LRU),
+    tick(0),
+    randState(0x2545f4914f6cdd1dULL),
+    memAccesses(0),
+    totalNs(0)
+{}
+
+/**
+ * @brief      Sets the line size and replacement policy of all levels. Must
+ *             be called before any level is added.
+ *
+ * @param[in]  lineSize  The line size in bytes
+ * @param[in]  policy    The replacement policy
+ */
+void CacheModel::setLine(unsigned lineSize, CachePolicy policy)
+{
+    this->lineSize = lineSize;
+    this->policy = policy;
+}
+
+/**
+ * @brief      Adds the next level of the hierarchy, empty.
+ *
+ * @param[in]  level   The level (index into CACHE_LEVEL_NAMES)
+ * @param[in]  sizeKB  The capacity in kilobytes
+ * @param[in]  ways    The associativity
+ */
+void CacheModel::addLevel(unsigned level, unsigned long sizeKB, unsigned ways)
+{
+    cacheLevel newLevel;
+
+    newLevel.name = CACHE_LEVEL_NAMES[level];
+    newLevel.latencyNs = CACHE_HIT_NS[level];
+    newLevel.sizeKB = sizeKB;
+    newLevel.ways = ways;
+    newLevel.numSets = (unsigned long long) sizeKB * 1024 / ((unsigned long long) this->lineSize * ways);
+    newLevel.accesses = 0;
+    newLevel.hits = 0;
+
+    if (newLevel.numSets == 0)
+    {
+        throw std::string("Error: " + newLevel.name + " cache is smaller than one set");
+    }
+
+    newLevel.tags.assign(newLevel.numSets * ways, 0);
+    newLevel.stamps.assign(newLevel.numSets * ways, 0);
+
+    this->levels.push_back(newLevel);
+}
+
+/**
+ * @brief      Performs one access: looks the line up level by level until it
+ *             hits, and fills it into every level that missed, replacing an
+ *             empty line or else the victim chosen by the policy.
+ *
+ * @param[in]  addr  The byte address
+ *
+ * @return     The latency of the access in nanoseconds.
+ */
+unsigned CacheModel::access(unsigned long long addr)
+{
+    unsigned long long line = addr / this->lineSize;
+    unsigned latency = CACHE_MEMORY_NS;
+    unsigned hitLevel = this->levels.size();
+
+    this->tick++;
+
+    for (unsigned l = 0; l < this->levels.size() && hitLevel == this->levels.size(); l++)
+    {
+        cacheLevel &level = this->levels[l];
+        unsigned long long base = (line % level.numSets) * level.ways;
+
+        level.accesses++;
+
+        for (unsigned k = 0; k < level.ways; k++)
+        {
+            if (level.tags[base + k] == line + 1)
+            {
+                if (this->policy == CACHE_LRU)
+                {
+                    level.stamps[base + k] = this->tick;
+                }
+
+                level.hits++;
+                hitLevel = l;
+                latency = level.latencyNs;
+                break;
+            }
+        }
+    }
+
+    for (unsigned l = 0; l < hitLevel; l++)
+    {
+        cacheLevel &level = this->levels[l];
+        unsigned long long base = (line % level.numSets) * level.ways;
+        unsigned victim = 0;
+
+        if (this->policy == CACHE_RANDOM)
+        {
+            this->randState ^= this->randState << 13;
+            this->randState ^= this->randState >> 7;
+            this->randState ^= this->randState << 17;
+            victim = (unsigned) (this->randState % level.ways);
+        }
+
+        for (unsigned k = 0; k < level.ways; k++)
+        {
+            if (level.tags[base + k] == 0)
+            {
+                victim = k;
+                break;
+            }
+
+            if (this->policy != CACHE_RANDOM &&
+                level.stamps[base + k] < level.stamps[base + victim])
+            {
+                victim = k;
+            }
+        }
+
+        level.tags[base + victim] = line + 1;
+        level.stamps[base + victim] = this->tick;
+    }
+
+    if (hitLevel == this->levels.size())
+    {
+        this->memAccesses++;
+    }
+
+    this->totalNs += latency;
+
+    return latency;
+}
+
+/**
+ * @brief      Saves the contents and statistics of every level to a
+ *             checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void CacheModel::save(Checkpoint &ckpt) const
+{
+    ckpt.putUInt(this->tick);
+    ckpt.putUInt(this->randState);
+    ckpt.putUInt(this->memAccesses);
+    ckpt.putUInt(this->totalNs);
+    ckpt.putUInt(this->levels.size());
+
+    for (const cacheLevel &level: this->levels)
+    {
+        ckpt.putUInt(level.tags.size());
+        ckpt.putUInt(level.accesses);
+        ckpt.putUInt(level.hits);
+
+        for (unsigned long long k = 0; k < level.tags.size(); k++)
+        {
+            ckpt.putUInt(level.tags[k]);
+            ckpt.putUInt(level.stamps[k]);
+        }
+    }
+}
+
+/**
+ * @brief      Restores the contents and statistics of every level from a
+ *             checkpoint. The levels must have been configured as when they
+ *             were saved.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void CacheModel::restore(Checkpoint &ckpt)
+{
+    this->tick        = ckpt.getUInt();
+    this->randState   = ckpt.getUInt();
+    this->memAccesses = ckpt.getUInt();
+    this->totalNs     = ckpt.getUInt();
+
+    if (ckpt.getUInt() != this->levels.size())
+    {
+        throw std::string("Error: checkpoint does not match configuration");
+    }
+
+    for (cacheLevel &level: this->levels)
+    {
+        if (ckpt.getUInt() != level.tags.size())
+        {
+            throw std::string("Error: checkpoint does not match configuration");
+        }
+
+        level.accesses = ckpt.getUInt();
+        level.hits     = ckpt.getUInt();
+
+        for (unsigned long long k = 0; k < level.tags.size(); k++)
+        {
+            level.tags[k]   = ckpt.getUInt();
+            level.stamps[k] = ckpt.getUInt();
+        }
+    }
+}
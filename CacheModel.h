@@ -0,0 +1,143 @@
+/**
+ * @file CacheModel.h
+ * 
+ * @brief Definition file for CacheModel class
+ * 
+ * @details Specifies all member methods of the CacheModel class, which
+ *          models the processor's cache hierarchy: up to three
+ *          set-associative levels (L1, L2 and LLC) with a common line size
+ *          and replacement policy, in front of main memory. Each level is
+ *          looked up in turn and every level that missed is filled with the
+ *          line.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of CacheModel class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef CACHE_MODEL_H
+#define CACHE_MODEL_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <vector>       // levels and their lines
+
+#include "Checkpoint.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum CachePolicy {CACHE_LRU, CACHE_FIFO, CACHE_RANDOM, NUM_CACHE_POLICIES};
+
+const std::string CACHE_POLICY_NAMES[NUM_CACHE_POLICIES] = {
+    "LRU", "FIFO", "RANDOM"
+};
+
+const unsigned NUM_CACHE_LEVELS = 3;
+
+const std::string CACHE_LEVEL_NAMES[NUM_CACHE_LEVELS] = {
+    "L1", "L2", "LLC"
+};
+
+const unsigned CACHE_HIT_NS[NUM_CACHE_LEVELS] = {1, 4, 15};    // load-to-use
+const unsigned CACHE_MEMORY_NS = 80;                            // miss to memory
+const unsigned DEFAULT_CACHE_WAYS = 8;
+const unsigned DEFAULT_CACHE_LINE = 64;                         // bytes
+
+// address streams of memory instructions
+const unsigned CACHE_ACCESSES_PER_CYCLE = 64;
+const unsigned CACHE_WORD = 8;                                  // bytes per access
+const unsigned CACHE_RUN_WORDS = 4;                             // consecutive words
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+
+/**
+ * Struct to hold one level of the hierarchy. Line k of set s is entry
+ * s * ways + k of tags and stamps; a tag of 0 marks an empty line.
+ */
+struct cacheLevel
+{
+    std::string name;
+    unsigned latencyNs;
+    unsigned long sizeKB;
+    unsigned ways;
+    unsigned long long numSets;
+    std::vector<unsigned long long> tags;       // line number + 1
+    std::vector<unsigned long long> stamps;     // last use (LRU) or fill (FIFO)
+    unsigned long long accesses, hits;
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class CacheModel
+{
+public:
+    CacheModel();
+
+    void addLevel(unsigned level, unsigned long sizeKB, unsigned ways);
+    void setLine(unsigned lineSize, CachePolicy policy);
+    unsigned access(unsigned long long addr);
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Gets the number of cache levels.
+     *
+     * @return     The number of levels (0 if the model is not used).
+     */
+    inline unsigned getNumLevels() const { return this->levels.size(); }
+
+    /**
+     * @brief      Gets a cache level.
+     *
+     * @param[in]  level  The level, from the one closest to the processor
+     *
+     * @return     The level.
+     */
+    inline const cacheLevel& getLevel(unsigned level) const { return this->levels[level]; }
+
+    /**
+     * @brief      Gets the line size.
+     *
+     * @return     The line size in bytes.
+     */
+    inline unsigned getLineSize() const { return this->lineSize; }
+
+    /**
+     * @brief      Gets the replacement policy.
+     *
+     * @return     The policy.
+     */
+    inline CachePolicy getPolicy() const { return this->policy; }
+
+    /**
+     * @brief      Gets the number of accesses that missed every level.
+     *
+     * @return     The number of accesses.
+     */
+    inline unsigned long long getMemoryAccesses() const { return this->memAccesses; }
+
+    /**
+     * @brief      Gets the total latency of all accesses.
+     *
+     * @return     The latency in nanoseconds.
+     */
+    inline unsigned long long getTotalNs() const { return this->totalNs; }
+private:
+    std::vector<cacheLevel> levels;
+    unsigned lineSize;
+    CachePolicy policy;
+    unsigned long long tick;
+    unsigned long long randState;
+    unsigned long long memAccesses, totalNs;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // CACHE_MODEL_H
+//
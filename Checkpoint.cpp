@@ -0,0 +1,259 @@
+/**
+ * @file Checkpoint.cpp
+ * 
+ * @brief Implementation file for Checkpoint class
+ * 
+ * @details Implements all member methods of Checkpoint class
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Checkpoint class
+ * 
+ * @note Requries Checkpoint.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "Checkpoint.h"
+
+#include <cstdio>       // rename
+#include <cstring>      // memcpy, memcmp
+#include <fstream>      // ifstream, ofstream
+#include <iterator>     // istreambuf_iterator
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs an empty checkpoint.
+ */
+Checkpoint::Checkpoint() : readPos(0) {}
+
+/**
+ * @brief      Discards all values.
+ */
+void Checkpoint::clear()
+{
+    this->data.clear();
+    this->readPos = 0;
+}
+
+/**
+ * @brief      Writes the checkpoint to a file. The file is written under a 
+ *             temporary name and renamed into place, so an interrupted save 
+ *             never replaces the previous checkpoint with a partial one.
+ *
+ * @param[in]  filename  The checkpoint filename
+ */
+void Checkpoint::save(const std::string& filename) const
+{
+    std::string tmpFilename = filename + ".tmp";
+    std::ofstream file(tmpFilename.c_str(), std::ios::binary | std::ios::trunc);
+    unsigned long long sum = checksum();
+    char trailer[8];
+
+    if (!file.is_open())
+    {
+        throw std::string("Error: could not open checkpoint file \"" + 
+                          tmpFilename + "\"");
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        trailer[i] = (char) (sum >> (8 * i));
+    }
+
+    file.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    file.put((char) CHECKPOINT_VERSION);
+    file.write(this->data.data(), this->data.size());
+    file.write(trailer, sizeof(trailer));
+    file.close();
+
+    if (!file || rename(tmpFilename.c_str(), filename.c_str()) != 0)
+    {
+        throw std::string("Error: could not write checkpoint file \"" + 
+                          filename + "\"");
+    }
+}
+
+/**
+ * @brief      Reads a checkpoint from a file, verifying its header and 
+ *             checksum.
+ *
+ * @param[in]  filename  The checkpoint filename
+ */
+void Checkpoint::load(const std::string& filename)
+{
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    std::string contents;
+    unsigned long long sum = 0;
+    size_t headerLen = sizeof(CHECKPOINT_MAGIC) + 1;
+
+    if (!file.is_open())
+    {
+        throw std::string("Error: checkpoint file \"" + filename + 
+                          "\" does not exist");
+    }
+
+    contents.assign(std::istreambuf_iterator<char>(file), 
+                    std::istreambuf_iterator<char>());
+
+    if (contents.size() < headerLen + 8 || 
+        memcmp(contents.data(), CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0)
+    {
+        throw std::string("Error: invalid checkpoint file \"" + filename + "\"");
+    }
+
+    if ((unsigned char) contents[sizeof(CHECKPOINT_MAGIC)] != CHECKPOINT_VERSION)
+    {
+        throw std::string("Error: unsupported checkpoint version in \"" + 
+                          filename + "\"");
+    }
+
+    this->data = contents.substr(headerLen, contents.size() - headerLen - 8);
+    this->readPos = 0;
+
+    for (int i = 0; i < 8; i++)
+    {
+        sum |= (unsigned long long) (unsigned char) contents[contents.size() - 8 + i] << (8 * i);
+    }
+
+    if (sum != checksum())
+    {
+        throw std::string("Error: corrupt checkpoint file \"" + filename + "\"");
+    }
+}
+
+/**
+ * @brief      Appends an unsigned integer as a variable-length quantity.
+ *
+ * @param[in]  value  The value
+ */
+void Checkpoint::putUInt(unsigned long long value)
+{
+    while (value >= 0x80)
+    {
+        this->data += (char) ((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+
+    this->data += (char) value;
+}
+
+/**
+ * @brief      Appends a floating point value.
+ *
+ * @param[in]  value  The value
+ */
+void Checkpoint::putDouble(double value)
+{
+    unsigned long long bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    for (int i = 0; i < 8; i++)
+    {
+        this->data += (char) (bits >> (8 * i));
+    }
+}
+
+/**
+ * @brief      Appends a length-prefixed string.
+ *
+ * @param[in]  value  The value
+ */
+void Checkpoint::putString(const std::string& value)
+{
+    putUInt(value.size());
+    this->data += value;
+}
+
+/**
+ * @brief      Reads the next unsigned integer.
+ *
+ * @return     The value.
+ */
+unsigned long long Checkpoint::getUInt()
+{
+    unsigned long long value = 0;
+    unsigned shift = 0;
+    unsigned char byte;
+
+    do
+    {
+        if (this->readPos >= this->data.size() || shift > 63)
+        {
+            throw std::string("Error: checkpoint data truncated");
+        }
+
+        byte = (unsigned char) this->data[this->readPos++];
+        value |= (unsigned long long) (byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return value;
+}
+
+/**
+ * @brief      Reads the next floating point value.
+ *
+ * @return     The value.
+ */
+double Checkpoint::getDouble()
+{
+    unsigned long long bits = 0;
+    double value;
+
+    if (this->data.size() - this->readPos < 8)
+    {
+        throw std::string("Error: checkpoint data truncated");
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        bits |= (unsigned long long) (unsigned char) this->data[this->readPos++] << (8 * i);
+    }
+
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+/**
+ * @brief      Reads the next string.
+ *
+ * @return     The value.
+ */
+std::string Checkpoint::getString()
+{
+    unsigned long long len = getUInt();
+    std::string value;
+
+    if (this->data.size() - this->readPos < len)
+    {
+        throw std::string("Error: checkpoint data truncated");
+    }
+
+    value = this->data.substr(this->readPos, len);
+    this->readPos += len;
+
+    return value;
+}
+
+/**
+ * @brief      Computes the FNV-1a checksum of the checkpoint data.
+ *
+ * @return     The checksum.
+ */
+unsigned long long Checkpoint::checksum() const
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < this->data.size(); i++)
+    {
+        hash ^= (unsigned char) this->data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file Checkpoint.h
+ * 
+ * @brief Definition file for Checkpoint class
+ * 
+ * @details Specifies all member methods of the Checkpoint class, a compact 
+ *          binary archive of simulation state. Values are appended with the 
+ *          put methods and read back in the same order with the get methods;
+ *          integers are stored as variable-length (LEB128) quantities and the 
+ *          file ends with a checksum so truncated or corrupt checkpoints are 
+ *          rejected on load.
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for thread regions
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for the power model
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for tenants
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for context switch accounting
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for the cache model
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for open I/O batches
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for the disk model
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for I/O completions in flight
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Bump CHECKPOINT_VERSION for process completion times
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Checkpoint class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const char CHECKPOINT_MAGIC[8] = { 'S', 'I', 'M', '4', 'C', 'K', 'P', 'T' };
+const unsigned CHECKPOINT_VERSION = 10;
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class Checkpoint
+{
+public:
+    Checkpoint();
+
+    void clear();
+    void save(const std::string& filename) const;
+    void load(const std::string& filename);
+
+    void putUInt(unsigned long long value);
+    void putDouble(double value);
+    void putString(const std::string& value);
+
+    unsigned long long getUInt();
+    double getDouble();
+    std::string getString();
+
+    /**
+     * @brief      Determines if all values have been read back.
+     *
+     * @return     True if at the end of the checkpoint, False otherwise.
+     */
+    inline bool atEnd() const { return this->readPos == this->data.size(); }
+private:
+    unsigned long long checksum() const;
+
+    std::string data;
+    size_t readPos;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // CHECKPOINT_H
+//
@@ -5,6 +5,88 @@
  * 
  * @details Implements all member methods of Config class
  * 
+ * @version 1.16
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Processor quantity"
+ * 
+ * @version 1.15
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "DVFS Governor Code", 
+ *          "Processor P-states" and "DVFS Sample Interval {msec}"
+ * 
+ * @version 1.14
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Tenant File Paths" and 
+ *          "Tenant Weights"
+ * 
+ * @version 1.13
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Log Format" ("Text" or 
+ *          "Binary"); in binary format the log file takes only the encoded
+ *          records passed to logBinary()
+ * 
+ * @version 1.12
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Log Sink" ("Stream" or 
+ *          "Mapped"), "Log Sync" ("None", "Exit", "Window" or "Flush") and 
+ *          "Log Window {mbytes}"; the "Mapped" sink writes the log file 
+ *          through MappedLog
+ * 
+ * @version 1.11
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Context Switch Cost {usec}", 
+ *          "Dispatch Cost {usec}" and "Cache Refill Penalty {usec}"
+ * 
+ * @version 1.10
+ *          Adam Landis (19 October 2026)
+ *          Add support for new cache settings "L1 cache size {kbytes}", "L1 
+ *          cache associativity", "L2 cache size {kbytes}", "L2 cache 
+ *          associativity", "LLC size {kbytes}", "LLC associativity", "Cache 
+ *          line size {bytes}" and "Cache Replacement Code"
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "I/O Coalesce Window {usec}"
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Disk Scheduling Code", "Disk 
+ *          cylinders", "Disk seek time {usec}" and "Disk RPM"
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "I/O Mode" ("Blocking" or 
+ *          "Interrupt") and "Interrupt Cost {usec}"
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Profile config parsing
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          - Add support for new config settings "Checkpoint Interval {msec}" 
+ *            and "Checkpoint File Path"
+ *          - Add getLogPosition() and resumeLog(), which let a resumed run 
+ *            continue the log file where its checkpoint was taken
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Clock Mode" ("Real" or 
+ *          "Virtual")
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Add "Log Summary" log type, which disables per-event logging and 
+ *          sends end-of-run reports to the monitor
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          - Add support for new config setting "Log Level" ("Instruction" or
+ *            "Process")
+ *          - Resolve the log target once and keep the log file open for the 
+ *            run instead of reopening it for every line
+ *          - Add logData() overload taking a character buffer
+ * 
  * @version 1.01
  *          Adam Landis (24 April 2019)
  *          Add support for new config settings "Processor Quantum Number" and 
@@ -21,6 +103,9 @@
 // 
 #include "Config.h"
 #include "helpers.h"
+#include "Profiler.h"
+
+#include <unistd.h>     // truncate
 //
 // Class Member Implementation /////////////////////////////////////////////////
 //
@@ -30,14 +115,124 @@
  *
  * @param[in]  filename  The config filename
  */
-Config::Config(const std::string& filename): filename(filename)
+Config::Config(const std::string& filename): 
+    filename(filename), 
+    logTarget(LOG_NONE), 
+    logInstructions(true),
+    virtualClock(false),
+    interruptIO(false),
+    binaryFormat(false),
+    mappedSink(false),
+    logSync(SYNC_NONE)
 {
+    PROFILE_SCOPE(PHASE_CONFIG);
+
     std::ifstream configFile(this->filename, std::ios::in);
 
     validateConfigFile(configFile);
     parseConfigFile(configFile);
 
     configFile.close();
+
+    std::string logType = this->config["Log"];
+    std::string logLevel = this->config["Log Level"];
+    std::string clockMode = this->config["Clock Mode"];
+    std::string ioMode = this->config["I/O Mode"];
+    std::string logFormat = this->config["Log Format"];
+    std::string logSink = this->config["Log Sink"];
+    std::string logSync = this->config["Log Sync"];
+
+    if (logType == "Log to Monitor")
+    {
+        this->logTarget = LOG_MONITOR;
+    }
+    else if (logType == "Log to File")
+    {
+        this->logTarget = LOG_FILE;
+    }
+    else if (logType == "Log to Both")
+    {
+        this->logTarget = LOG_BOTH;
+    }
+    else if (logType == "Log Summary")
+    {
+        this->logTarget = LOG_SUMMARY;
+        this->logInstructions = false;
+    }
+
+    if (logLevel == "Process")
+    {
+        this->logInstructions = false;
+    }
+    else if (!logLevel.empty() && logLevel != "Instruction")
+    {
+        throw std::string("Error: invalid log level \"" + logLevel + "\"");
+    }
+
+    if (clockMode == "Virtual")
+    {
+        this->virtualClock = true;
+    }
+    else if (!clockMode.empty() && clockMode != "Real")
+    {
+        throw std::string("Error: invalid clock mode \"" + clockMode + "\"");
+    }
+
+    if (ioMode == "Interrupt")
+    {
+        this->interruptIO = true;
+    }
+    else if (!ioMode.empty() && ioMode != "Blocking")
+    {
+        throw std::string("Error: invalid I/O mode \"" + ioMode + "\"");
+    }
+
+    if (logFormat == "Binary")
+    {
+        this->binaryFormat = true;
+    }
+    else if (!logFormat.empty() && logFormat != "Text")
+    {
+        throw std::string("Error: invalid log format \"" + logFormat + "\"");
+    }
+
+    if (logSink == "Mapped")
+    {
+        this->mappedSink = true;
+    }
+    else if (!logSink.empty() && logSink != "Stream")
+    {
+        throw std::string("Error: invalid log sink \"" + logSink + "\"");
+    }
+
+    if (!logSync.empty())
+    {
+        unsigned policy = 0;
+
+        while (policy < NUM_SYNC_POLICIES && LOG_SYNC_NAMES[policy] != logSync)
+        {
+            policy++;
+        }
+
+        if (policy == NUM_SYNC_POLICIES)
+        {
+            throw std::string("Error: invalid log sync \"" + logSync + "\"");
+        }
+
+        this->logSync = (LogSyncPolicy) policy;
+    }
+}
+
+/**
+ * @brief      Destroys the object, flushing any buffered log data. The mapped
+ *             log is closed by its own destructor.
+ */
+Config::~Config()
+{
+    if (this->logFile.is_open())
+    {
+        this->logFile.close();
+    }
 }
 
 /**
@@ -147,25 +342,189 @@ std::string Config::genConfigLogData()
  */
 void Config::logData(std::string data)
 {
-    std::string logType = this->config["Log"];
-    std::string logFilePath = this->config["Log File Path"];
+    logData(data.data(), data.length());
+}
 
-    if (logType == "Log to Monitor")
+/**
+ * @brief      Logs a buffer of characters either to a file, monitor, or both
+ *             without allocating. A binary log file does not take text.
+ *
+ * @param[in]  data  The characters to log
+ * @param[in]  len   The number of characters
+ */
+void Config::logData(const char *data, size_t len)
+{
+    if (this->logTarget == LOG_NONE)
     {
-        logToMonitor(data);
+        throw std::string("Error: cannot log data - invalid or missing log type");
     }
-    else if (logType == "Log to File")
+
+    if (this->logTarget == LOG_MONITOR || this->logTarget == LOG_BOTH || 
+        this->logTarget == LOG_SUMMARY)
     {
-        logToFile(data, logFilePath);
+        std::cout.write(data, len);
     }
-    else if (logType == "Log to Both")
+
+    if ((this->logTarget == LOG_FILE || this->logTarget == LOG_BOTH) && 
+        !this->binaryFormat)
+    {
+        writeLog(data, len);
+    }
+}
+
+/**
+ * @brief      Logs encoded binary records to a binary log file; does nothing
+ *             for any other log.
+ *
+ * @param[in]  data  The encoded records
+ * @param[in]  len   The number of bytes
+ */
+void Config::logBinary(const char *data, size_t len)
+{
+    if (logsBinary())
+    {
+        writeLog(data, len);
+    }
+}
+
+/**
+ * @brief      Flushes buffered log data to the monitor and log file.
+ */
+void Config::flushLog()
+{
+    std::cout.flush();
+
+    if (this->logFile.is_open())
+    {
+        this->logFile.flush();
+    }
+
+    this->mappedLog.flush();
+}
+
+/**
+ * @brief      Gets the current end of the log file, flushing buffered data.
+ *
+ * @return     The log file size in bytes (0 when not logging to a file).
+ */
+unsigned long long Config::getLogPosition()
+{
+    if (this->logTarget != LOG_FILE && this->logTarget != LOG_BOTH)
+    {
+        return 0;
+    }
+
+    if (this->mappedSink)
+    {
+        if (!this->mappedLog.isOpen())
+        {
+            openLog();
+        }
+
+        this->mappedLog.flush();
+
+        return this->mappedLog.getSize();
+    }
+
+    if (!this->logFile.is_open())
+    {
+        openLog();
+    }
+
+    this->logFile.flush();
+    this->logFile.seekp(0, std::ios_base::end);
+
+    return (unsigned long long) this->logFile.tellp();
+}
+
+/**
+ * @brief      Discards everything logged to the log file after the given 
+ *             position, so a resumed run continues the log without duplicate
+ *             lines.
+ *
+ * @param[in]  position  The log position returned by getLogPosition()
+ */
+void Config::resumeLog(unsigned long long position)
+{
+    if (this->logTarget != LOG_FILE && this->logTarget != LOG_BOTH)
+    {
+        return;
+    }
+
+    if (this->logFile.is_open())
+    {
+        this->logFile.close();
+    }
+
+    this->mappedLog.close();
+
+    if (truncate(this->config["Log File Path"].c_str(), (off_t) position) != 0)
+    {
+        throw std::string("Error: cannot resume log file - unable to truncate log file");
+    }
+
+    openLog();
+}
+
+/**
+ * @brief      Writes to the log file, opening it first if needed.
+ *
+ * @param[in]  data  The bytes to write
+ * @param[in]  len   The number of bytes
+ */
+void Config::writeLog(const char *data, size_t len)
+{
+    if (this->mappedSink)
     {
-        logToMonitor(data);
-        logToFile(data, logFilePath);
+        if (!this->mappedLog.isOpen())
+        {
+            openLog();
+        }
+
+        this->mappedLog.append(data, len);
     }
     else
     {
-        throw std::string("Error: cannot log data - invalid or missing log type");
+        if (!this->logFile.is_open())
+        {
+            openLog();
+        }
+
+        this->logFile.write(data, len);
+    }
+}
+
+/**
+ * @brief      Opens the log file for appending, through the mapped sink if 
+ *             "Log Sink" is "Mapped".
+ */
+void Config::openLog()
+{
+    std::string logFilePath = this->config["Log File Path"];
+
+    if (logFilePath.empty())
+    {
+        throw std::string("Error: cannot log to file - filename missing");
+    }
+
+    if (this->mappedSink)
+    {
+        unsigned long windowMB = DEFAULT_LOG_WINDOW_MB;
+
+        if (!this->config["Log Window"].empty())
+        {
+            windowMB = std::stoul(this->config["Log Window"]);
+        }
+
+        this->mappedLog.open(logFilePath, windowMB, this->logSync);
+        return;
+    }
+
+    this->logFile.open(logFilePath, std::ios_base::app);
+
+    if (!this->logFile)
+    {
+        throw std::string("Error: cannot log to file - unable to open log file");
     }
 }
 
@@ -233,8 +592,21 @@ configSetting Config::parseConfigLine(const std::string& configLine)
 
     if (setting.key != "Version/Phase" &&
         setting.key != "File Path" &&
+        setting.key != "Tenant File Paths" &&
+        setting.key != "Tenant Weights" &&
         setting.key != "Log" &&
         setting.key != "Log File Path" &&
+        setting.key != "Log Level" &&
+        setting.key != "Log Format" &&
+        setting.key != "Log Sink" &&
+        setting.key != "Log Sync" &&
+        setting.key != "Clock Mode" &&
+        setting.key != "I/O Mode" &&
+        setting.key != "Disk Scheduling Code" &&
+        setting.key != "Cache Replacement Code" &&
+        setting.key != "DVFS Governor Code" &&
+        setting.key != "Processor P-states" &&
+        setting.key != "Checkpoint File Path" &&
         setting.key != "CPU Scheduling Code")
     {
         if (!isPositiveInteger(settingValue))
@@ -262,16 +634,69 @@ std::string Config::getShortConfigSettingName(const std::string& longStr)
 
     if (longStr != "Version/Phase" &&
         longStr != "File Path" &&
+        longStr != "Tenant File Paths" &&
+        longStr != "Tenant Weights" &&
         longStr != "Log" &&
         longStr != "Log File Path" &&
+        longStr != "Log Level" &&
+        longStr != "Log Format" &&
+        longStr != "Log Sink" &&
+        longStr != "Log Sync" &&
+        longStr != "Clock Mode" &&
+        longStr != "I/O Mode" &&
+        longStr != "Disk Scheduling Code" &&
+        longStr != "Disk cylinders" &&
+        longStr != "Disk RPM" &&
+        longStr != "Checkpoint File Path" &&
         longStr != "CPU Scheduling Code" &&
         longStr != "Processor Quantum Number" &&
+        longStr != "DVFS Governor Code" &&
+        longStr != "Processor P-states" &&
         longStr.find("quantity") == std::string::npos)
     {
         if (longStr.find("Memory block size") != std::string::npos)
         {
             result = "Memory block size";
         }
+        else if (longStr.find("Log Window") != std::string::npos)
+        {
+            result = "Log Window";
+        }
+        else if (longStr.find("Checkpoint Interval") != std::string::npos)
+        {
+            result = "Checkpoint Interval";
+        }
+        else if (longStr.find("Interrupt Cost") != std::string::npos)
+        {
+            result = "Interrupt Cost";
+        }
+        else if (longStr.find("Disk seek time") != std::string::npos)
+        {
+            result = "Disk seek time";
+        }
+        else if (longStr.find("I/O Coalesce Window") != std::string::npos)
+        {
+            result = "I/O Coalesce Window";
+        }
+        else if (longStr.find("Context Switch Cost") != std::string::npos)
+        {
+            result = "Context Switch Cost";
+        }
+        else if (longStr.find("Dispatch Cost") != std::string::npos)
+        {
+            result = "Dispatch Cost";
+        }
+        else if (longStr.find("DVFS Sample Interval") != std::string::npos)
+        {
+            result = "DVFS Sample Interval";
+        }
+        else if (longStr.find("cache") != std::string::npos || 
+                 longStr.find("Cache") != std::string::npos ||
+                 longStr.find("LLC") != std::string::npos)
+        {
+            // cache settings keep their level in the name
+            result = longStr.substr(0, longStr.find(" {"));
+        }
         else
         {
             size_t end = longStr.find(' ');
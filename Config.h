@@ -5,6 +5,82 @@
  * 
  * @details Specifies all member methods of the Config class
  * 
+ * @version 1.16
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Processor quantity"
+ * 
+ * @version 1.15
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "DVFS Governor Code", 
+ *          "Processor P-states" and "DVFS Sample Interval {msec}"
+ * 
+ * @version 1.14
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Tenant File Paths" and 
+ *          "Tenant Weights"
+ * 
+ * @version 1.13
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Log Format" ("Text" or 
+ *          "Binary"), logBinary(), logsBinary() and logsText()
+ * 
+ * @version 1.12
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Log Sink" ("Stream" or 
+ *          "Mapped"), "Log Sync" and "Log Window {mbytes}"
+ * 
+ * @version 1.11
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Context Switch Cost {usec}", 
+ *          "Dispatch Cost {usec}" and "Cache Refill Penalty {usec}"
+ * 
+ * @version 1.10
+ *          Adam Landis (19 October 2026)
+ *          Add support for new cache settings "L1 cache size {kbytes}", "L1 
+ *          cache associativity", "L2 cache size {kbytes}", "L2 cache 
+ *          associativity", "LLC size {kbytes}", "LLC associativity", "Cache 
+ *          line size {bytes}" and "Cache Replacement Code"
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "I/O Coalesce Window {usec}"
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "Disk Scheduling Code", "Disk 
+ *          cylinders", "Disk seek time {usec}" and "Disk RPM"
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config settings "I/O Mode" ("Blocking" or 
+ *          "Interrupt") and "Interrupt Cost {usec}" and 
+ *          usesInterruptIO()
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add setSettingVal() for what-if variants
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          - Add support for new config settings "Checkpoint Interval {msec}" 
+ *            and "Checkpoint File Path"
+ *          - Add getLogPosition() and resumeLog() for checkpoints
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Add support for new config setting "Clock Mode" and 
+ *          usesVirtualClock()
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Add "Log Summary" log type and isSummaryLog()
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          - Add support for new config setting "Log Level"
+ *          - Add logData() overload taking a character buffer, which writes 
+ *            through a log file stream kept open for the run
+ * 
  * @version 1.01
  *          Adam Landis (24 April 2019)
  *          Add support for new config settings "Processor Quantum Number" and 
@@ -28,6 +104,8 @@
 #include <fstream>      // ifstream
 #include <map>          // for the config map
 #include <iostream>
+
+#include "MappedLog.h"
 //
 // Class/Struct Definitions ////////////////////////////////////////////////////
 //
@@ -44,18 +122,28 @@ struct configSetting
 //
 typedef std::map<std::string, std::string> configMap;
 //
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum LogTarget {LOG_NONE, LOG_MONITOR, LOG_FILE, LOG_BOTH, LOG_SUMMARY};
+//
 // Class Definition ////////////////////////////////////////////////////////////
 // 
 class Config
 {
 public:
     Config(const std::string& filename);
+    ~Config();
     void validateConfigFile(std::ifstream& configFile);
     void parseConfigFile(std::ifstream& configFile);
     configSetting parseConfigLine(const std::string& configLine);
     void logConfigFileData();
     std::string genConfigLogData();
     void logData(std::string data);
+    void logData(const char *data, size_t len);
+    void logBinary(const char *data, size_t len);
+    void flushLog();
+    unsigned long long getLogPosition();
+    void resumeLog(unsigned long long position);
 
     std::string getShortConfigSettingName(const std::string& longStr);
     const configSetting getConfigSetting(const std::string& descriptor);
@@ -75,14 +163,85 @@ public:
      * @return     The setting value.
      */
     std::string getSettingVal(std::string key) { return this->config[key]; }
+
+    /**
+     * @brief      Overrides the value of a setting.
+     *
+     * @param[in]  key    The setting key
+     * @param[in]  value  The setting value
+     */
+    void setSettingVal(std::string key, std::string value) { this->config[key] = value; }
+
+    /**
+     * @brief      Determines if per-instruction log lines are enabled 
+     *             ("Log Level" is not "Process").
+     *
+     * @return     True if instruction lines should be logged, False otherwise.
+     */
+    inline bool logsInstructions() const { return this->logInstructions; }
+
+    /**
+     * @brief      Determines if the run is summary-only ("Log Summary"), in 
+     *             which case only end-of-run reports are logged to the monitor.
+     *
+     * @return     True if summary-only, False otherwise.
+     */
+    inline bool isSummaryLog() const { return this->logTarget == LOG_SUMMARY; }
+
+    /**
+     * @brief      Determines if the log file takes binary event records 
+     *             ("Log Format" is "Binary") instead of text.
+     *
+     * @return     True if binary records are logged, False otherwise.
+     */
+    inline bool logsBinary() const { return this->binaryFormat && (this->logTarget == LOG_FILE || this->logTarget == LOG_BOTH); }
+
+    /**
+     * @brief      Determines if any log target takes text lines, which is not 
+     *             the case when logging only to a binary log file.
+     *
+     * @return     True if text is logged, False otherwise.
+     */
+    inline bool logsText() const { return !(this->binaryFormat && this->logTarget == LOG_FILE); }
+
+    /**
+     * @brief      Determines if the simulation runs on a virtual clock ("Clock 
+     *             Mode" is "Virtual") instead of busy-waiting in real time.
+     *
+     * @return     True if virtual time, False if real time.
+     */
+    inline bool usesVirtualClock() const { return this->virtualClock; }
+
+    /**
+     * @brief      Determines if processes release the processor while their 
+     *             I/O is in progress ("I/O Mode" is "Interrupt") instead of 
+     *             blocking it until the I/O completes.
+     *
+     * @return     True if I/O is interrupt-driven, False if blocking.
+     */
+    inline bool usesInterruptIO() const { return this->interruptIO; }
 private:
+    void openLog();
+    void writeLog(const char *data, size_t len);
+
     std::string filename;
+    LogTarget logTarget;
+    bool logInstructions;
+    bool virtualClock;
+    bool interruptIO;
+    std::ofstream logFile;
+    bool binaryFormat;
+    bool mappedSink;
+    LogSyncPolicy logSync;
+    MappedLog mappedLog;
     configMap config;
     const std::string CONFIG_HEADER = "Start Simulator Configuration File";
     const std::string CONFIG_FOOTER = "End Simulator Configuration File";
-    const std::string CONFIG_SETTING_NAMES[17] = {
+    const std::string CONFIG_SETTING_NAMES[49] = {
             "Version/Phase",
             "File Path",
+            "Tenant File Paths",
+            "Tenant Weights",
             "Monitor display time {msec}",
             "Processor cycle time {msec}",
             "Scanner cycle time {msec}",
@@ -94,10 +253,40 @@ private:
             "Memory block size {kbytes}",
             "Projector quantity",
             "Hard drive quantity",
+            "Processor quantity",
             "Log",
             "Log File Path",
+            "Log Level",
+            "Log Format",
+            "Log Sink",
+            "Log Sync",
+            "Log Window {mbytes}",
             "Processor Quantum Number",
-            "CPU Scheduling Code"
+            "CPU Scheduling Code",
+            "Clock Mode",
+            "Checkpoint Interval {msec}",
+            "Checkpoint File Path",
+            "I/O Mode",
+            "Interrupt Cost {usec}",
+            "Disk Scheduling Code",
+            "Disk cylinders",
+            "Disk seek time {usec}",
+            "Disk RPM",
+            "I/O Coalesce Window {usec}",
+            "L1 cache size {kbytes}",
+            "L1 cache associativity",
+            "L2 cache size {kbytes}",
+            "L2 cache associativity",
+            "LLC size {kbytes}",
+            "LLC associativity",
+            "Cache line size {bytes}",
+            "Cache Replacement Code",
+            "Context Switch Cost {usec}",
+            "Dispatch Cost {usec}",
+            "Cache Refill Penalty {usec}",
+            "DVFS Governor Code",
+            "Processor P-states",
+            "DVFS Sample Interval {msec}"
     };
 };
 //
@@ -0,0 +1,353 @@
+/**
+ * @file DiskScheduler.cpp
+ * 
+ * @brief Implementation file for DiskScheduler class
+ * 
+ * @details Implements all member methods of DiskScheduler class. Seek time 
+ *          grows with the square root of the distance travelled plus a fixed
+ *          settle time; the platter angle follows the simulation clock, so 
+ *          rotational latency depends on when the head arrives.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Place requests with mixBits() from helpers
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of DiskScheduler class
+ * 
+ * @note Requries DiskScheduler.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "DiskScheduler.h"
+#include "helpers.h"
+
+#include <cmath>        // sqrt, llround
+#include <algorithm>    // std::max
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs an idle drive with its head at cylinder 0.
+ *
+ * @param[in]  policy     The request scheduling policy
+ * @param[in]  cylinders  The number of cylinders (at least 2)
+ * @param[in]  seekUs     The full-stroke seek time in microseconds
+ * @param[in]  rpm        The rotational speed in revolutions per minute
+ */
+DiskScheduler::DiskScheduler(DiskPolicy policy, unsigned cylinders, 
+                             unsigned long seekUs, unsigned long rpm) :
+    policy(policy),
+    cylinders(std::max(cylinders, 2u)),
+    fullSeekUs(seekUs),
+    revolutionUs(60000000UL / std::max(rpm, 1UL)),
+    head(0),
+    movingUp(true),
+    busy(false),
+    sweep(0),
+    nextSeq(0),
+    requests(0),
+    seekDistance(0),
+    seekUs(0),
+    rotationUs(0),
+    responseUs(0),
+    maxQueue(0)
+{}
+
+/**
+ * @brief      Creates a request for an I/O instruction. Each process's data 
+ *             lies within a tenth of the disk around a home cylinder, and 
+ *             each instruction has its own cylinder and sector there.
+ *
+ * @param[in]  idx         The PCB table index of the process
+ * @param[in]  pid         The pid of the process
+ * @param[in]  pc          The index of the instruction in the process
+ * @param[in]  issueUs     The time of issue in microseconds
+ * @param[in]  transferUs  The transfer time in microseconds
+ *
+ * @return     The request.
+ */
+diskRequest DiskScheduler::makeRequest(unsigned idx, unsigned pid, unsigned pc, 
+                                       unsigned long long issueUs, 
+                                       unsigned long long transferUs) const
+{
+    unsigned long long home = mixBits(pid) % this->cylinders;
+    unsigned long long h = mixBits(((unsigned long long) pid << 32) | pc);
+    diskRequest req;
+
+    req.idx = idx;
+    req.cylinder = (unsigned) ((home + h % (this->cylinders / 10 + 1)) % this->cylinders);
+    req.sector = (unsigned) ((h >> 32) % DISK_SECTORS);
+    req.issueUs = issueUs;
+    req.transferUs = transferUs;
+    req.seq = 0;
+
+    return req;
+}
+
+/**
+ * @brief      Queues a request.
+ *
+ * @param[in]  req   The request
+ */
+void DiskScheduler::add(const diskRequest &req)
+{
+    this->pending.push_back(req);
+    this->pending.back().seq = this->nextSeq++;
+    this->maxQueue = std::max(this->maxQueue, (unsigned long long) this->pending.size());
+}
+
+/**
+ * @brief      Starts serving the next request once the drive is free. Only 
+ *             requests issued by then are considered; if there are none, the
+ *             drive idles until the earliest one is issued.
+ *
+ * @param[in]  freeUs      The time the drive became free in microseconds
+ * @param      req         The request started
+ * @param      completeUs  The time the request completes in microseconds
+ *
+ * @return     False if no request is pending, True otherwise.
+ */
+bool DiskScheduler::startNext(unsigned long long freeUs, diskRequest &req, 
+                              unsigned long long &completeUs)
+{
+    unsigned long long startUs, distance, seek, arriveUs, sectorUs, rotation;
+    size_t pos;
+
+    if (this->pending.empty())
+    {
+        return false;
+    }
+
+    pos = pick(freeUs);
+    req = this->pending[pos];
+    this->pending.erase(this->pending.begin() + pos);
+
+    startUs = std::max(freeUs, req.issueUs);
+    distance = this->sweep + 
+        (req.cylinder > this->head ? req.cylinder - this->head : this->head - req.cylinder);
+    seek = getSeekTime(distance);
+    arriveUs = startUs + seek;
+    sectorUs = (unsigned long long) req.sector * this->revolutionUs / DISK_SECTORS;
+    rotation = (sectorUs + this->revolutionUs - arriveUs % this->revolutionUs) % 
+               this->revolutionUs;
+    completeUs = arriveUs + rotation + req.transferUs;
+
+    this->head = req.cylinder;
+    this->sweep = 0;
+    this->busy = true;
+
+    this->requests++;
+    this->seekDistance += distance;
+    this->seekUs += seek;
+    this->rotationUs += rotation;
+    this->responseUs += completeUs - req.issueUs;
+
+    return true;
+}
+
+/**
+ * @brief      Gets the time to move the head a given distance.
+ *
+ * @param[in]  distance  The distance in cylinders
+ *
+ * @return     The seek time in microseconds (0 for no movement).
+ */
+unsigned long long DiskScheduler::getSeekTime(unsigned long long distance) const
+{
+    if (distance == 0)
+    {
+        return 0;
+    }
+
+    double stroke = std::sqrt((double) (distance - 1) / (this->cylinders - 1));
+
+    return (unsigned long long) llround(this->fullSeekUs * 
+        (DISK_SETTLE_FRACTION + (1.0 - DISK_SETTLE_FRACTION) * stroke));
+}
+
+/**
+ * @brief      Picks the pending request to serve next according to the 
+ *             policy. Ties go to the earliest issued request.
+ *
+ * @param[in]  freeUs  The time the drive became free in microseconds
+ *
+ * @return     The position of the request in the pending queue.
+ */
+size_t DiskScheduler::pick(unsigned long long freeUs)
+{
+    size_t best = this->pending.size();
+
+    for (size_t k = 0; k < this->pending.size(); k++)
+    {
+        if (this->pending[k].issueUs <= freeUs && 
+            (best == this->pending.size() || this->pending[k].seq < this->pending[best].seq))
+        {
+            best = k;
+        }
+    }
+
+    if (best == this->pending.size())
+    {
+        // nothing issued yet: idle until the earliest request
+        for (size_t k = 0; k < this->pending.size(); k++)
+        {
+            if (k == 0 || this->pending[k].issueUs < this->pending[best].issueUs)
+            {
+                best = k;
+            }
+        }
+
+        return best;
+    }
+
+    switch (this->policy)
+    {
+        case DISK_SSTF:
+            best = closest(freeUs, 0);
+            break;
+
+        case DISK_SCAN:
+            best = closest(freeUs, this->movingUp ? 1 : -1);
+
+            if (best == this->pending.size())
+            {
+                // nothing ahead: travel on to the edge and reverse
+                unsigned edge = this->movingUp ? this->cylinders - 1 : 0;
+
+                this->sweep += this->movingUp ? edge - this->head : this->head;
+                this->head = edge;
+                this->movingUp = !this->movingUp;
+                best = closest(freeUs, this->movingUp ? 1 : -1);
+            }
+            break;
+
+        case DISK_CLOOK:
+            best = closest(freeUs, 1);
+
+            if (best == this->pending.size())
+            {
+                // nothing ahead: return to the lowest request
+                unsigned from = this->head;
+
+                this->head = 0;
+                best = closest(freeUs, 1);
+                this->head = from;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return best;
+}
+
+/**
+ * @brief      Finds the issued request closest to the head, optionally only in
+ *             one direction. Ties go to the earliest issued request.
+ *
+ * @param[in]  freeUs     The time the drive became free in microseconds
+ * @param[in]  direction  1 for cylinders at or above the head, -1 for at or 
+ *                        below, 0 for both
+ *
+ * @return     The position of the request in the pending queue, or the queue 
+ *             size if there is none.
+ */
+size_t DiskScheduler::closest(unsigned long long freeUs, int direction) const
+{
+    size_t best = this->pending.size();
+    unsigned bestDist = 0;
+
+    for (size_t k = 0; k < this->pending.size(); k++)
+    {
+        const diskRequest &req = this->pending[k];
+        unsigned dist = (req.cylinder > this->head) ? req.cylinder - this->head : 
+                                                      this->head - req.cylinder;
+
+        if (req.issueUs > freeUs || 
+            (direction > 0 && req.cylinder < this->head) ||
+            (direction < 0 && req.cylinder > this->head))
+        {
+            continue;
+        }
+
+        if (best == this->pending.size() || dist < bestDist || 
+            (dist == bestDist && req.seq < this->pending[best].seq))
+        {
+            best = k;
+            bestDist = dist;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief      Saves the drive state to a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void DiskScheduler::save(Checkpoint &ckpt) const
+{
+    ckpt.putUInt(this->head);
+    ckpt.putUInt(this->movingUp);
+    ckpt.putUInt(this->busy);
+    ckpt.putUInt(this->sweep);
+    ckpt.putUInt(this->nextSeq);
+    ckpt.putUInt(this->requests);
+    ckpt.putUInt(this->seekDistance);
+    ckpt.putUInt(this->seekUs);
+    ckpt.putUInt(this->rotationUs);
+    ckpt.putUInt(this->responseUs);
+    ckpt.putUInt(this->maxQueue);
+    ckpt.putUInt(this->pending.size());
+
+    for (const diskRequest &req: this->pending)
+    {
+        ckpt.putUInt(req.idx);
+        ckpt.putUInt(req.cylinder);
+        ckpt.putUInt(req.sector);
+        ckpt.putUInt(req.issueUs);
+        ckpt.putUInt(req.transferUs);
+        ckpt.putUInt(req.seq);
+    }
+}
+
+/**
+ * @brief      Restores the drive state from a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void DiskScheduler::restore(Checkpoint &ckpt)
+{
+    unsigned long long size;
+
+    this->head         = (unsigned) ckpt.getUInt();
+    this->movingUp     = ckpt.getUInt() != 0;
+    this->busy         = ckpt.getUInt() != 0;
+    this->sweep        = ckpt.getUInt();
+    this->nextSeq      = ckpt.getUInt();
+    this->requests     = ckpt.getUInt();
+    this->seekDistance = ckpt.getUInt();
+    this->seekUs       = ckpt.getUInt();
+    this->rotationUs   = ckpt.getUInt();
+    this->responseUs   = ckpt.getUInt();
+    this->maxQueue     = ckpt.getUInt();
+
+    size = ckpt.getUInt();
+    this->pending.resize(size);
+
+    for (diskRequest &req: this->pending)
+    {
+        req.idx        = (unsigned) ckpt.getUInt();
+        req.cylinder   = (unsigned) ckpt.getUInt();
+        req.sector     = (unsigned) ckpt.getUInt();
+        req.issueUs    = ckpt.getUInt();
+        req.transferUs = ckpt.getUInt();
+        req.seq        = ckpt.getUInt();
+    }
+}
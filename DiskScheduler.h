@@ -0,0 +1,148 @@
+/**
+ * @file DiskScheduler.h
+ * 
+ * @brief Definition file for DiskScheduler class
+ * 
+ * @details Specifies all member methods of the DiskScheduler class, which 
+ *          models one hard drive: a head moving over the cylinders, a 
+ *          rotating platter and a queue of pending requests served in FCFS, 
+ *          SSTF, SCAN or C-LOOK order. A request's service time is its seek,
+ *          rotational latency and transfer time.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of DiskScheduler class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef DISK_SCHEDULER_H
+#define DISK_SCHEDULER_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <vector>       // pending requests
+
+#include "Checkpoint.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum DiskPolicy {DISK_FCFS, DISK_SSTF, DISK_SCAN, DISK_CLOOK, NUM_DISK_POLICIES};
+
+const std::string DISK_POLICY_NAMES[NUM_DISK_POLICIES] = {
+    "FCFS", "SSTF", "SCAN", "C-LOOK"
+};
+
+const unsigned DEFAULT_DISK_CYLINDERS = 1000;
+const unsigned long DEFAULT_DISK_SEEK_US = 10000;   // full-stroke seek
+const unsigned long DEFAULT_DISK_RPM = 7200;
+const unsigned DISK_SECTORS = 1024;                 // angular positions per track
+const double DISK_SETTLE_FRACTION = 0.1;            // of a full seek, per seek
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+
+/**
+ * Struct to hold one hard drive request waiting for or in service
+ */
+struct diskRequest
+{
+    unsigned idx;                       // PCB table index of the process
+    unsigned cylinder, sector;
+    unsigned long long issueUs, transferUs, seq;
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class DiskScheduler
+{
+public:
+    DiskScheduler(DiskPolicy policy, unsigned cylinders, unsigned long seekUs, 
+                  unsigned long rpm);
+
+    diskRequest makeRequest(unsigned idx, unsigned pid, unsigned pc, 
+                            unsigned long long issueUs, 
+                            unsigned long long transferUs) const;
+    void add(const diskRequest &req);
+    bool startNext(unsigned long long freeUs, diskRequest &req, 
+                   unsigned long long &completeUs);
+    unsigned long long getSeekTime(unsigned long long distance) const;
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Marks the request in service as finished.
+     */
+    inline void finish() { this->busy = false; }
+
+    /**
+     * @brief      Determines if a request is in service.
+     *
+     * @return     True if busy, False if idle.
+     */
+    inline bool isBusy() const { return this->busy; }
+
+    /**
+     * @brief      Gets the number of requests served.
+     *
+     * @return     The number of requests.
+     */
+    inline unsigned long long getRequests() const { return this->requests; }
+
+    /**
+     * @brief      Gets the total head travel.
+     *
+     * @return     The distance in cylinders.
+     */
+    inline unsigned long long getSeekDistance() const { return this->seekDistance; }
+
+    /**
+     * @brief      Gets the total seek time.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getSeekUs() const { return this->seekUs; }
+
+    /**
+     * @brief      Gets the total rotational latency.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getRotationUs() const { return this->rotationUs; }
+
+    /**
+     * @brief      Gets the total response time (issue to completion).
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getResponseUs() const { return this->responseUs; }
+
+    /**
+     * @brief      Gets the longest the pending request queue has been.
+     *
+     * @return     The number of requests.
+     */
+    inline unsigned long long getMaxQueue() const { return this->maxQueue; }
+private:
+    size_t pick(unsigned long long freeUs);
+    size_t closest(unsigned long long freeUs, int direction) const;
+
+    DiskPolicy policy;
+    unsigned cylinders;
+    unsigned long fullSeekUs, revolutionUs;
+    unsigned head;
+    bool movingUp, busy;
+    unsigned long long sweep;           // SCAN travel to the edge before reversing
+    unsigned long long nextSeq;
+    std::vector<diskRequest> pending;
+    unsigned long long requests, seekDistance, seekUs, rotationUs, responseUs;
+    unsigned long long maxQueue;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // DISK_SCHEDULER_H
+//
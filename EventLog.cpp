@@ -0,0 +1,391 @@
+/**
+ * @file EventLog.cpp
+ * 
+ * @brief Implementation file for EventLog class
+ * 
+ * @details Implements all member methods of EventLog class. Every run that
+ *          writes to a log starts a new segment, which resets the string
+ *          table and the time base, so logs appended by several runs, or cut
+ *          back by a resumed checkpoint, still decode.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Encode and decode the thread of instruction lines; decode logs of 
+ *          either version
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of EventLog class
+ * 
+ * @note Requries EventLog.h
+ */
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "EventLog.h"
+#include "LogBuffer.h"
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs an encoder or decoder before its first segment.
+ */
+EventLog::EventLog() :
+    started(false),
+    lastUs(0)
+{}
+
+/**
+ * @brief      Encodes the start or end line of an instruction.
+ *
+ * @param[in]  usec     The time of the line in microseconds
+ * @param[in]  instr    The instruction
+ * @param[in]  isStart  True for the start line, False for the end line
+ * @param[in]  pid      The pid of the executing process
+ * @param[in]  arg      The device unit (hard drive and projector start lines)
+ *                      or the allocated address (allocate end lines)
+ * @param[in]  thread   The thread of the process (0 for its main thread)
+ */
+void EventLog::instruction(unsigned long long usec, const MetadataInstruction &instr,
+                           bool isStart, unsigned pid, unsigned long long arg, 
+                           unsigned thread)
+{
+    Descriptor descId = instr.getDescId();
+    unsigned char type = EVENT_INSTR | (isStart ? EVENT_START : 0) | 
+                         (thread != 0 ? EVENT_THREAD : 0) | descId;
+    bool explicitCode = (instr.getCode() != EVENT_DEFAULT_CODES[descId]);
+
+    this->bytes.clear();
+    startRecord(type | (explicitCode ? EVENT_CODE : 0), usec);
+
+    if (explicitCode)
+    {
+        this->bytes.push_back(instr.getCode());
+    }
+
+    putUInt(pid);
+
+    if (thread != 0)
+    {
+        putUInt(thread);
+    }
+
+    if (isStart ? (descId == DESC_HARD_DRIVE || descId == DESC_PROJECTOR) :
+                  (descId == DESC_ALLOCATE))
+    {
+        putUInt(arg);
+    }
+}
+
+/**
+ * @brief      Encodes an event line.
+ *
+ * @param[in]  usec  The time of the line in microseconds
+ * @param[in]  msg   The message (including trailing newline), which must stay
+ *                   valid for the life of the encoder
+ */
+void EventLog::message(unsigned long long usec, const char *msg)
+{
+    this->bytes.clear();
+    putString(msg);
+    startRecord(EVENT_MESSAGE, usec);
+    putUInt(this->stringIds[msg]);
+}
+
+/**
+ * @brief      Encodes an event line about a process.
+ *
+ * @param[in]  usec    The time of the line in microseconds
+ * @param[in]  prefix  The message text before the pid
+ * @param[in]  pid     The pid
+ * @param[in]  suffix  The message text after the pid (including newline)
+ */
+void EventLog::message(unsigned long long usec, const char *prefix, unsigned pid,
+                       const char *suffix)
+{
+    this->bytes.clear();
+    putString(prefix);
+    putString(suffix);
+    startRecord(EVENT_PROCESS, usec);
+    putUInt(this->stringIds[prefix]);
+    putUInt(pid);
+    putUInt(this->stringIds[suffix]);
+}
+
+/**
+ * @brief      Encodes free text, such as an end-of-run report, as it is.
+ *
+ * @param[in]  data  The text
+ */
+void EventLog::text(const std::string &data)
+{
+    this->bytes.clear();
+    startRecord(EVENT_TEXT, this->lastUs);
+    putUInt(data.size());
+    this->bytes.append(data);
+}
+
+/**
+ * @brief      Decodes the record at a position in an encoded log and appends
+ *             the text it stands for.
+ *
+ * @param[in]  in    The encoded log
+ * @param      pos   The position of the record, moved past it
+ * @param      out   The decoded text
+ *
+ * @return     False if there are no more records, True otherwise.
+ */
+bool EventLog::decode(const std::string &in, size_t &pos, std::string &out)
+{
+    LogBuffer line;
+    unsigned char type;
+
+    if (pos >= in.size())
+    {
+        return false;
+    }
+
+    type = (unsigned char) in[pos++];
+
+    if (type == EVENT_SEGMENT)
+    {
+        if (pos + sizeof(EVENT_LOG_MAGIC) >= in.size() ||
+            in.compare(pos, sizeof(EVENT_LOG_MAGIC), EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC)) != 0 ||
+            (unsigned char) in[pos + sizeof(EVENT_LOG_MAGIC)] == 0 ||
+            (unsigned char) in[pos + sizeof(EVENT_LOG_MAGIC)] > EVENT_LOG_VERSION)
+        {
+            throw std::string("Error: cannot decode log - not a binary event log");
+        }
+
+        pos += sizeof(EVENT_LOG_MAGIC) + 1;
+        this->started = true;
+        this->lastUs = 0;
+        this->strings.clear();
+
+        return true;
+    }
+
+    if (!this->started)
+    {
+        throw std::string("Error: cannot decode log - not a binary event log");
+    }
+
+    if (type == EVENT_STRING || type == EVENT_TEXT)
+    {
+        unsigned long long len = getUInt(in, pos);
+
+        if (len > in.size() - pos)
+        {
+            throw std::string("Error: cannot decode log - log is truncated");
+        }
+
+        if (type == EVENT_STRING)
+        {
+            this->strings.push_back(in.substr(pos, len));
+        }
+        else
+        {
+            out.append(in, pos, len);
+        }
+
+        pos += len;
+
+        return true;
+    }
+
+    if (!(type & EVENT_INSTR) && type != EVENT_MESSAGE && type != EVENT_PROCESS)
+    {
+        throw std::string("Error: cannot decode log - invalid record");
+    }
+
+    unsigned long long zigzag = getUInt(in, pos);
+
+    // times are deltas from the previous record, zigzag encoded
+    this->lastUs += (zigzag & 1) ? ~(zigzag >> 1) : (zigzag >> 1);
+
+    line.appendTime(this->lastUs);
+    line.append(" - ");
+
+    if (type & EVENT_INSTR)
+    {
+        unsigned descId = type & 0x0f;
+        bool isStart = (type & EVENT_START);
+        char code;
+        unsigned pid, thread = 0;
+
+        if (descId >= NUM_DESCRIPTORS || ((type & EVENT_CODE) && pos >= in.size()))
+        {
+            throw std::string("Error: cannot decode log - invalid record");
+        }
+
+        code = (type & EVENT_CODE) ? in[pos++] : EVENT_DEFAULT_CODES[descId];
+        pid = (unsigned) getUInt(in, pos);
+
+        if (type & EVENT_THREAD)
+        {
+            thread = (unsigned) getUInt(in, pos);
+        }
+
+        std::map<unsigned, MetadataInstruction>::iterator it =
+            this->instrs.find(((unsigned char) code << 4) | descId);
+
+        if (it == this->instrs.end())
+        {
+            it = this->instrs.insert(std::make_pair(((unsigned char) code << 4) | descId,
+                     MetadataInstruction(code, DESCRIPTOR_NAMES[descId], 0))).first;
+        }
+
+        it->second.appendLogString(line, isStart, pid, thread);
+
+        if (isStart && (descId == DESC_HARD_DRIVE || descId == DESC_PROJECTOR))
+        {
+            line.appendUInt(getUInt(in, pos));
+        }
+        else if (!isStart && descId == DESC_ALLOCATE)
+        {
+            line.append(' ');
+            line.appendHex((unsigned) getUInt(in, pos));
+        }
+
+        line.append('\n');
+    }
+    else if (type == EVENT_MESSAGE)
+    {
+        line.append(getString(in, pos));
+    }
+    else
+    {
+        line.append(getString(in, pos));
+        line.appendUInt(getUInt(in, pos));
+        line.append(getString(in, pos));
+    }
+
+    out.append(line.data(), line.size());
+
+    return true;
+}
+
+/**
+ * @brief      Starts encoding a record after any strings it needs, beginning
+ *             the segment first if it is the first record of the run.
+ *
+ * @param[in]  type  The record type
+ * @param[in]  usec  The time of the record in microseconds
+ */
+void EventLog::startRecord(unsigned char type, unsigned long long usec)
+{
+    long long delta = (long long) (usec - this->lastUs);
+
+    if (!this->started)
+    {
+        // the segment header goes ahead of any strings already encoded
+        std::string pending;
+
+        pending.swap(this->bytes);
+        this->bytes.push_back(EVENT_SEGMENT);
+        this->bytes.append(EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC));
+        this->bytes.push_back(EVENT_LOG_VERSION);
+        this->bytes.append(pending);
+        this->started = true;
+    }
+
+    this->bytes.push_back(type);
+
+    if (type != EVENT_TEXT)
+    {
+        putUInt(((unsigned long long) delta << 1) ^ (unsigned long long) (delta >> 63));
+        this->lastUs = usec;
+    }
+}
+
+/**
+ * @brief      Encodes an unsigned integer as a varint: seven bits per byte,
+ *             low bits first, with the top bit set on all but the last byte.
+ *
+ * @param[in]  num   The number
+ */
+void EventLog::putUInt(unsigned long long num)
+{
+    while (num >= 0x80)
+    {
+        this->bytes.push_back((char) (num | 0x80));
+        num >>= 7;
+    }
+
+    this->bytes.push_back((char) num);
+}
+
+/**
+ * @brief      Adds a message text to the string table, encoding it if it is
+ *             new.
+ *
+ * @param[in]  str   The text
+ */
+void EventLog::putString(const char *str)
+{
+    if (this->stringIds.count(str) != 0)
+    {
+        return;
+    }
+
+    size_t len = std::char_traits<char>::length(str);
+    unsigned long long id = this->stringIds.size();
+
+    this->stringIds[str] = id;
+    this->bytes.push_back(EVENT_STRING);
+    putUInt(len);
+    this->bytes.append(str, len);
+}
+
+/**
+ * @brief      Decodes a varint.
+ *
+ * @param[in]  in    The encoded log
+ * @param      pos   The position of the varint, moved past it
+ *
+ * @return     The number.
+ */
+unsigned long long EventLog::getUInt(const std::string &in, size_t &pos)
+{
+    unsigned long long num = 0;
+    unsigned shift = 0;
+
+    while (true)
+    {
+        if (pos >= in.size() || shift > 63)
+        {
+            throw std::string("Error: cannot decode log - log is truncated");
+        }
+
+        unsigned char byte = (unsigned char) in[pos++];
+
+        num |= (unsigned long long) (byte & 0x7f) << shift;
+        shift += 7;
+
+        if (!(byte & 0x80))
+        {
+            return num;
+        }
+    }
+}
+
+/**
+ * @brief      Decodes a reference to the string table.
+ *
+ * @param[in]  in    The encoded log
+ * @param      pos   The position of the reference, moved past it
+ *
+ * @return     The string.
+ */
+const std::string& EventLog::getString(const std::string &in, size_t &pos)
+{
+    unsigned long long id = getUInt(in, pos);
+
+    if (id >= this->strings.size())
+    {
+        throw std::string("Error: cannot decode log - invalid record");
+    }
+
+    return this->strings[id];
+}
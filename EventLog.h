@@ -0,0 +1,107 @@
+/**
+ * @file EventLog.h
+ * 
+ * @brief Definition file for EventLog class
+ * 
+ * @details Specifies all member methods of the EventLog class, which encodes
+ *          log lines as compact binary records and decodes them back into the
+ *          exact text the simulator would have logged. Instruction lines are
+ *          stored as their descriptor, pid, thread and device unit or
+ *          address; other event lines refer to their message text through a
+ *          table of strings built up in the log itself. Times are stored as
+ *          varint deltas from the previous record.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add EVENT_THREAD for instruction lines of a process's threads and
+ *          bump EVENT_LOG_VERSION
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of EventLog class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <vector>           // decoded string table
+#include <map>              // decoded instructions
+#include <unordered_map>    // encoded string table
+
+#include "MetadataInstruction.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+
+// record types; instruction records set EVENT_INSTR in their first byte
+enum EventRecord {EVENT_SEGMENT, EVENT_STRING, EVENT_MESSAGE, EVENT_PROCESS,
+                  EVENT_TEXT};
+
+const unsigned char EVENT_INSTR = 0x80;
+const unsigned char EVENT_START = 0x40;         // instruction start line
+const unsigned char EVENT_CODE  = 0x20;         // code byte follows
+const unsigned char EVENT_THREAD = 0x10;        // thread follows the pid
+
+// the code assumed for each descriptor unless the record gives one
+const char EVENT_DEFAULT_CODES[NUM_DESCRIPTORS] = {
+    'A', 'A', 'I', 'I', 'I', 'O', 'P', 'M', 'O', 'M', 'T', 'T', 'T'
+};
+
+const char EVENT_LOG_MAGIC[7] = { 'S', 'I', 'M', '4', 'L', 'O', 'G' };
+const unsigned char EVENT_LOG_VERSION = 2;     // 1 had no thread records
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class EventLog
+{
+public:
+    EventLog();
+
+    void instruction(unsigned long long usec, const MetadataInstruction &instr,
+                     bool isStart, unsigned pid, unsigned long long arg, 
+                     unsigned thread = 0);
+    void message(unsigned long long usec, const char *msg);
+    void message(unsigned long long usec, const char *prefix, unsigned pid,
+                 const char *suffix);
+    void text(const std::string &data);
+    bool decode(const std::string &in, size_t &pos, std::string &out);
+
+    /**
+     * @brief      Gets the bytes encoded by the last call.
+     *
+     * @return     Pointer to the bytes.
+     */
+    inline const char *data() const { return this->bytes.data(); }
+
+    /**
+     * @brief      Gets the number of bytes encoded by the last call.
+     *
+     * @return     The number of bytes.
+     */
+    inline size_t size() const { return this->bytes.size(); }
+private:
+    void startRecord(unsigned char type, unsigned long long usec);
+    void putUInt(unsigned long long num);
+    void putString(const char *str);
+    unsigned long long getUInt(const std::string &in, size_t &pos);
+    const std::string& getString(const std::string &in, size_t &pos);
+
+    std::string bytes;
+    bool started;
+    unsigned long long lastUs;
+    std::unordered_map<const char*, unsigned long long> stringIds;
+    std::vector<std::string> strings;
+    std::map<unsigned, MetadataInstruction> instrs;     // by code and descriptor
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // EVENT_LOG_H
+//
@@ -0,0 +1,197 @@
+/**
+ * @file IOBatcher.cpp
+ * 
+ * @brief Implementation file for IOBatcher class
+ * 
+ * @details Implements all member methods of IOBatcher class. A batch opens
+ *          with its first request and accepts more until the coalescing
+ *          window has passed or, if the unit is still busy then, until the
+ *          unit becomes free.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of IOBatcher class
+ * 
+ * @note Requries IOBatcher.h
+ */
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "IOBatcher.h"
+
+#include <string>
+#include <algorithm>    // std::max, std::min
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the submission queue of a device with no open
+ *             batches.
+ *
+ * @param[in]  windowUs  The coalescing window in microseconds
+ * @param[in]  numUnits  The number of units (0 to not batch the device)
+ */
+IOBatcher::IOBatcher(unsigned long windowUs, unsigned numUnits) :
+    windowUs(windowUs),
+    batches(numUnits),
+    numOpen(0),
+    requests(0),
+    numBatches(0),
+    maxBatch(0),
+    savedUs(0)
+{}
+
+/**
+ * @brief      Adds a request to the open batch of a unit, or opens a batch
+ *             for it if the unit has none.
+ *
+ * @param[in]  unit       The unit
+ * @param[in]  idx        The PCB table index of the issuing process
+ * @param[in]  code       The instruction code ('I' or 'O')
+ * @param[in]  serviceUs  The service time of the request in microseconds
+ * @param[in]  nowUs      The time of issue in microseconds
+ * @param[in]  freeUs     The time the unit becomes free in microseconds
+ *
+ * @return     False if the open batch cannot take the request (it is in the
+ *             other direction or has closed) and must be sealed first, True
+ *             otherwise.
+ */
+bool IOBatcher::add(unsigned unit, unsigned idx, char code,
+                    unsigned long long serviceUs, unsigned long long nowUs,
+                    unsigned long long freeUs)
+{
+    ioBatch &batch = this->batches[unit];
+
+    if (batch.members.empty())
+    {
+        batch.code = code;
+        batch.closeUs = std::max(nowUs + this->windowUs, freeUs);
+        batch.serviceUs = 0;
+        batch.totalUs = 0;
+        this->numOpen++;
+    }
+    else if (batch.code != code || nowUs > batch.closeUs)
+    {
+        return false;
+    }
+
+    batch.members.push_back(idx);
+    batch.serviceUs = std::max(batch.serviceUs, serviceUs);
+    batch.totalUs += serviceUs;
+
+    return true;
+}
+
+/**
+ * @brief      Closes the open batch of a unit and starts serving it as one
+ *             operation, no earlier than the unit becomes free.
+ *
+ * @param[in]  unit     The unit
+ * @param[in]  atUs     The time the batch is sealed in microseconds (the
+ *                      close time, or earlier if it is cut short)
+ * @param[in]  freeUs   The time the unit becomes free in microseconds
+ * @param      members  The PCB table indices of the requests in the batch
+ *
+ * @return     The time the batch completes in microseconds.
+ */
+unsigned long long IOBatcher::seal(unsigned unit, unsigned long long atUs,
+                                   unsigned long long freeUs,
+                                   std::vector<unsigned> &members)
+{
+    ioBatch &batch = this->batches[unit];
+    unsigned long long startUs = std::max(std::min(atUs, batch.closeUs), freeUs);
+
+    this->requests += batch.members.size();
+    this->numBatches++;
+    this->maxBatch = std::max(this->maxBatch, (unsigned long long) batch.members.size());
+    this->savedUs += batch.totalUs - batch.serviceUs;
+    this->numOpen--;
+
+    members.clear();
+    members.swap(batch.members);
+
+    return startUs + batch.serviceUs;
+}
+
+/**
+ * @brief      Saves the open batches and statistics to a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void IOBatcher::save(Checkpoint &ckpt) const
+{
+    ckpt.putUInt(this->requests);
+    ckpt.putUInt(this->numBatches);
+    ckpt.putUInt(this->maxBatch);
+    ckpt.putUInt(this->savedUs);
+    ckpt.putUInt(this->batches.size());
+
+    for (const ioBatch &batch: this->batches)
+    {
+        ckpt.putUInt(batch.members.size());
+
+        if (!batch.members.empty())
+        {
+            ckpt.putUInt(batch.code);
+            ckpt.putUInt(batch.closeUs);
+            ckpt.putUInt(batch.serviceUs);
+            ckpt.putUInt(batch.totalUs);
+
+            for (unsigned idx: batch.members)
+            {
+                ckpt.putUInt(idx);
+            }
+        }
+    }
+}
+
+/**
+ * @brief      Restores the open batches and statistics from a checkpoint. The
+ *             device may have a different number of units than when it was
+ *             saved, as long as no batch is open on a unit that is gone.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void IOBatcher::restore(Checkpoint &ckpt)
+{
+    unsigned long long numUnits;
+
+    this->requests   = ckpt.getUInt();
+    this->numBatches = ckpt.getUInt();
+    this->maxBatch   = ckpt.getUInt();
+    this->savedUs    = ckpt.getUInt();
+    this->numOpen    = 0;
+
+    numUnits = ckpt.getUInt();
+
+    for (unsigned long long u = 0; u < numUnits; u++)
+    {
+        unsigned long long size = ckpt.getUInt();
+
+        if (size == 0)
+        {
+            continue;
+        }
+
+        if (u >= this->batches.size())
+        {
+            throw std::string("Error: checkpoint does not match configuration");
+        }
+
+        ioBatch &batch = this->batches[u];
+
+        batch.code      = (char) ckpt.getUInt();
+        batch.closeUs   = ckpt.getUInt();
+        batch.serviceUs = ckpt.getUInt();
+        batch.totalUs   = ckpt.getUInt();
+        batch.members.resize(size);
+
+        for (unsigned &idx: batch.members)
+        {
+            idx = (unsigned) ckpt.getUInt();
+        }
+
+        this->numOpen++;
+    }
+}
@@ -0,0 +1,131 @@
+/**
+ * @file IOBatcher.h
+ * 
+ * @brief Definition file for IOBatcher class
+ * 
+ * @details Specifies all member methods of the IOBatcher class, the
+ *          submission queue of one device type. Each unit of the device has
+ *          at most one open batch; requests in the same direction issued
+ *          while it is open join it, and the whole batch is later served as
+ *          one operation taking as long as its longest request.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of IOBatcher class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef IO_BATCHER_H
+#define IO_BATCHER_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <vector>       // open batches and their members
+
+#include "Checkpoint.h"
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+
+/**
+ * Struct to hold the open batch of one device unit
+ */
+struct ioBatch
+{
+    std::vector<unsigned> members;      // PCB table indices, in issue order
+    char code;                          // 'I' or 'O'
+    unsigned long long closeUs;         // last time a request may join
+    unsigned long long serviceUs;       // longest member service time
+    unsigned long long totalUs;         // sum of member service times
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class IOBatcher
+{
+public:
+    IOBatcher(unsigned long windowUs, unsigned numUnits);
+
+    bool add(unsigned unit, unsigned idx, char code, unsigned long long serviceUs,
+             unsigned long long nowUs, unsigned long long freeUs);
+    unsigned long long seal(unsigned unit, unsigned long long atUs,
+                            unsigned long long freeUs,
+                            std::vector<unsigned> &members);
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Gets the number of units of the device.
+     *
+     * @return     The number of units (0 if the device is not batched).
+     */
+    inline unsigned getNumUnits() const { return this->batches.size(); }
+
+    /**
+     * @brief      Determines if a unit has an open batch.
+     *
+     * @param[in]  unit  The unit
+     *
+     * @return     True if open, False otherwise.
+     */
+    inline bool isOpen(unsigned unit) const { return !this->batches[unit].members.empty(); }
+
+    /**
+     * @brief      Gets the last time a request may join the open batch of a
+     *             unit.
+     *
+     * @param[in]  unit  The unit
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getCloseUs(unsigned unit) const { return this->batches[unit].closeUs; }
+
+    /**
+     * @brief      Gets the number of open batches over all units.
+     *
+     * @return     The number of open batches.
+     */
+    inline unsigned getNumOpen() const { return this->numOpen; }
+
+    /**
+     * @brief      Gets the number of requests served in batches.
+     *
+     * @return     The number of requests.
+     */
+    inline unsigned long long getRequests() const { return this->requests; }
+
+    /**
+     * @brief      Gets the number of batches served.
+     *
+     * @return     The number of batches.
+     */
+    inline unsigned long long getBatches() const { return this->numBatches; }
+
+    /**
+     * @brief      Gets the size of the largest batch served.
+     *
+     * @return     The number of requests.
+     */
+    inline unsigned long long getMaxBatch() const { return this->maxBatch; }
+
+    /**
+     * @brief      Gets the service time saved by serving requests in batches
+     *             rather than one at a time.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getSavedUs() const { return this->savedUs; }
+private:
+    unsigned long windowUs;
+    std::vector<ioBatch> batches;       // one per unit
+    unsigned numOpen;
+    unsigned long long requests, numBatches, maxBatch, savedUs;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // IO_BATCHER_H
+//
@@ -0,0 +1,91 @@
+/**
+ * @file IOCompletionQueue.cpp
+ * 
+ * @brief Implementation file for IOCompletionQueue class
+ * 
+ * @details Implements all member methods of IOCompletionQueue class. Records 
+ *          form a singly linked list from tail to head around a stub record: 
+ *          a producer swaps itself in as head with one atomic exchange and 
+ *          then links the previous head to it, so producers never wait for 
+ *          each other or for the consumer.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of IOCompletionQueue class
+ * 
+ * @note Requries IOCompletionQueue.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "IOCompletionQueue.h"
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs an empty queue.
+ */
+IOCompletionQueue::IOCompletionQueue() : head(&stub), tail(&stub) {}
+
+/**
+ * @brief      Posts a completion record. Safe to call from any thread.
+ *
+ * @param      rec   The record, which must not be in the queue
+ */
+void IOCompletionQueue::push(ioCompletion *rec)
+{
+    ioCompletion *prev;
+
+    rec->next.store(nullptr, std::memory_order_relaxed);
+    prev = this->head.exchange(rec, std::memory_order_acq_rel);
+    prev->next.store(rec, std::memory_order_release);
+}
+
+/**
+ * @brief      Takes the oldest completion record. Must only be called from the
+ *             consumer (scheduler) thread.
+ *
+ * @return     The record, or NULL if the queue is empty or a producer has not
+ *             finished linking its record yet (it will be returned by a later
+ *             call).
+ */
+ioCompletion* IOCompletionQueue::pop()
+{
+    ioCompletion *oldest = this->tail;
+    ioCompletion *next = oldest->next.load(std::memory_order_acquire);
+
+    if (oldest == &this->stub)
+    {
+        if (next == nullptr)
+        {
+            return nullptr;
+        }
+
+        this->tail = oldest = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr)
+    {
+        this->tail = next;
+        return oldest;
+    }
+
+    if (oldest != this->head.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    // oldest is the only record; put the stub behind it so it can be unlinked
+    push(&this->stub);
+    next = oldest->next.load(std::memory_order_acquire);
+
+    if (next != nullptr)
+    {
+        this->tail = next;
+        return oldest;
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file IOCompletionQueue.h
+ * 
+ * @brief Definition file for IOCompletionQueue class
+ * 
+ * @details Specifies all member methods of the IOCompletionQueue class, a 
+ *          lock-free multi-producer/single-consumer queue through which device
+ *          threads post I/O completion records (simulated interrupts) to the 
+ *          scheduler. Records are intrusive, so posting never allocates.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add ioCompletion::queued for requests waiting in a disk queue
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of IOCompletionQueue class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef IO_COMPLETION_QUEUE_H
+#define IO_COMPLETION_QUEUE_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <atomic>
+
+#include "MetadataInstruction.h"
+#include "SimClock.h"
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+class IOCompletionQueue;
+
+/**
+ * Struct to hold one I/O operation from issue until its completion record is 
+ * handled by the scheduler. Each process has at most one in flight.
+ */
+struct ioCompletion
+{
+    std::atomic<ioCompletion*> next;
+    const MetadataInstruction *instr;
+    unsigned idx, unit;
+    unsigned long long completeUs;      // simulation time the device finishes
+    unsigned long costUs;               // interrupt handling cost
+    bool blocking;                      // process keeps the processor meanwhile
+    bool queued;                        // waiting in a disk queue, not posted
+    SimClock *clock;
+    IOCompletionQueue *queue;
+
+    ioCompletion() : next(nullptr), instr(nullptr), idx(0), unit(0), 
+                     completeUs(0), costUs(0), blocking(true), queued(false),
+                     clock(nullptr), queue(nullptr) {}
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class IOCompletionQueue
+{
+public:
+    IOCompletionQueue();
+    IOCompletionQueue(const IOCompletionQueue &) = delete;
+    IOCompletionQueue& operator=(const IOCompletionQueue &) = delete;
+
+    void push(ioCompletion *rec);
+    ioCompletion* pop();
+private:
+    std::atomic<ioCompletion*> head;    // most recently pushed, producers only
+    ioCompletion *tail;                 // oldest, consumer only
+    ioCompletion stub;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // IO_COMPLETION_QUEUE_H
+//
@@ -0,0 +1,189 @@
+/**
+ * @file LiveStats.cpp
+ * 
+ * @brief Implementation file for LiveStats class
+ * 
+ * @details Implements all member methods of LiveStats class
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of LiveStats class
+ * 
+ * @note Requries LiveStats.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "LiveStats.h"
+
+#include <cstring>      // memcpy, memcmp
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap
+#include <unistd.h>     // ftruncate, close, getpid
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+LiveStats::LiveStats() : page(NULL) {}
+
+/**
+ * @brief      Destroys the object, unmapping the stats file.
+ */
+LiveStats::~LiveStats()
+{
+    close();
+}
+
+/**
+ * @brief      Creates (or truncates) a stats file and maps it for publishing.
+ *
+ * @param[in]  filename  The stats filename
+ */
+void LiveStats::create(const std::string& filename)
+{
+    int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0 || ftruncate(fd, sizeof(liveStatsPage)) != 0)
+    {
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+
+        throw std::string("Error: could not create stats file \"" + filename + "\"");
+    }
+
+    map(fd, true);
+
+    this->page->seq.store(0, std::memory_order_relaxed);
+    this->page->version = LIVE_STATS_VERSION;
+    this->page->numWords = LIVE_SNAPSHOT_WORDS;
+    memcpy(this->page->magic, LIVE_STATS_MAGIC, sizeof(LIVE_STATS_MAGIC));
+
+    this->wallTimer.startTimer();
+}
+
+/**
+ * @brief      Maps an existing stats file for reading.
+ *
+ * @param[in]  filename  The stats filename
+ */
+void LiveStats::open(const std::string& filename)
+{
+    int fd = ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        throw std::string("Error: stats file \"" + filename + "\" does not exist");
+    }
+
+    if (lseek(fd, 0, SEEK_END) < (off_t) sizeof(liveStatsPage))
+    {
+        ::close(fd);
+        throw std::string("Error: invalid stats file \"" + filename + "\"");
+    }
+
+    map(fd, false);
+
+    if (memcmp(this->page->magic, LIVE_STATS_MAGIC, sizeof(LIVE_STATS_MAGIC)) != 0 ||
+        this->page->version != LIVE_STATS_VERSION || 
+        this->page->numWords != LIVE_SNAPSHOT_WORDS)
+    {
+        close();
+        throw std::string("Error: invalid stats file \"" + filename + "\"");
+    }
+}
+
+/**
+ * @brief      Unmaps the stats file.
+ */
+void LiveStats::close()
+{
+    if (this->page)
+    {
+        munmap(this->page, sizeof(liveStatsPage));
+        this->page = NULL;
+    }
+}
+
+/**
+ * @brief      Publishes a snapshot. The wall time and writer pid are filled 
+ *             in here.
+ *
+ * @param      snap  The snapshot
+ */
+void LiveStats::publish(liveSnapshot &snap)
+{
+    uint64_t words[LIVE_SNAPSHOT_WORDS];
+    uint64_t seq = this->page->seq.load(std::memory_order_relaxed);
+
+    snap.wallUs = this->wallTimer.getMicroseconds();
+    snap.writerPid = (uint64_t) getpid();
+    memcpy(words, &snap, sizeof(words));
+
+    this->page->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (unsigned w = 0; w < LIVE_SNAPSHOT_WORDS; w++)
+    {
+        this->page->words[w].store(words[w], std::memory_order_relaxed);
+    }
+
+    this->page->seq.store(seq + 2, std::memory_order_release);
+}
+
+/**
+ * @brief      Reads a consistent snapshot, retrying while the writer is 
+ *             publishing.
+ *
+ * @param      snap  The snapshot read
+ *
+ * @return     False if nothing has been published yet, True otherwise.
+ */
+bool LiveStats::read(liveSnapshot &snap) const
+{
+    uint64_t words[LIVE_SNAPSHOT_WORDS];
+    uint64_t before, after;
+
+    do
+    {
+        before = this->page->seq.load(std::memory_order_acquire);
+
+        for (unsigned w = 0; w < LIVE_SNAPSHOT_WORDS; w++)
+        {
+            words[w] = this->page->words[w].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = this->page->seq.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    memcpy(&snap, words, sizeof(words));
+
+    return before != 0;
+}
+
+/**
+ * @brief      Maps the stats page of an open file and closes the descriptor.
+ *
+ * @param[in]  fd        The file descriptor
+ * @param[in]  writable  True to map for writing, False for reading
+ */
+void LiveStats::map(int fd, bool writable)
+{
+    void *addr = mmap(NULL, sizeof(liveStatsPage), 
+                      writable ? PROT_READ | PROT_WRITE : PROT_READ, 
+                      MAP_SHARED, fd, 0);
+
+    ::close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        throw std::string("Error: could not map stats file");
+    }
+
+    this->page = (liveStatsPage*) addr;
+}
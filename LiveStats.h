@@ -0,0 +1,94 @@
+/**
+ * @file LiveStats.h
+ * 
+ * @brief Definition file for LiveStats class
+ * 
+ * @details Specifies all member methods of the LiveStats class, which shares
+ *          a snapshot of a running simulation through a memory-mapped stats 
+ *          file. The writer publishes under a sequence lock: it makes the 
+ *          sequence number odd, stores the snapshot words and makes it even 
+ *          again, so publishing never blocks and readers (simstat) retry 
+ *          until they copy a snapshot with an unchanged, even sequence.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of LiveStats class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef LIVE_STATS_H
+#define LIVE_STATS_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <atomic>       // sequence lock and snapshot words
+#include <stdint.h>     // uint64_t
+
+#include "MetadataInstruction.h"
+#include "Timer.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const char LIVE_STATS_MAGIC[8] = { 'S', 'I', 'M', '4', 'L', 'I', 'V', 'E' };
+const uint64_t LIVE_STATS_VERSION = 1;
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+struct liveSnapshot
+{
+    uint64_t clockUs;               // simulation time
+    uint64_t wallUs;                // wall time since the stats file opened
+    uint64_t writerPid;
+    uint64_t finished;              // 1 once the run has ended
+    uint64_t instructions;          // instructions executed
+    uint64_t numProcesses;
+    uint64_t completed;             // processes in EXIT state
+    uint64_t ready;                 // ready queue length
+    uint64_t waiting;               // wait queue length
+    uint64_t memInUse;              // allocated memory (kbytes)
+    uint64_t sysMem;                // system memory (kbytes)
+    uint64_t busyUnits[NUM_DEVICES];
+    uint64_t totalUnits[NUM_DEVICES];
+    uint64_t deviceOps[NUM_DEVICES];
+    uint64_t deviceTimeUs[NUM_DEVICES];
+};
+
+const unsigned LIVE_SNAPSHOT_WORDS = sizeof(liveSnapshot) / sizeof(uint64_t);
+
+struct liveStatsPage
+{
+    char magic[8];
+    uint64_t version;
+    uint64_t numWords;
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> words[LIVE_SNAPSHOT_WORDS];
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class LiveStats
+{
+public:
+    LiveStats();
+    ~LiveStats();
+
+    void create(const std::string& filename);
+    void open(const std::string& filename);
+    void close();
+    void publish(liveSnapshot &snap);
+    bool read(liveSnapshot &snap) const;
+private:
+    void map(int fd, bool writable);
+
+    liveStatsPage *page;
+    Timer wallTimer;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // LIVE_STATS_H
+//
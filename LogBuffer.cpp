@@ -0,0 +1,137 @@
+/**
+ * @file LogBuffer.cpp
+ * 
+ * @brief Implementation file for LogBuffer class
+ * 
+ * @details Implements all member methods of LogBuffer class. All formatting is 
+ *          done in place; text that does not fit is truncated.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of LogBuffer class
+ * 
+ * @note Requries LogBuffer.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "LogBuffer.h"
+
+#include <cstring>      // memcpy, strlen
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+LogBuffer::LogBuffer() : len(0) {}
+
+/**
+ * @brief      Appends a timestamp in seconds with six fixed decimal places, 
+ *             matching the format of std::to_string(float).
+ *
+ * @param[in]  usec  The timestamp in microseconds
+ */
+void LogBuffer::appendTime(unsigned long long usec)
+{
+    char frac[6];
+    unsigned long long rem = usec % 1000000;
+
+    appendUInt(usec / 1000000);
+    append('.');
+
+    for (int i = 5; i >= 0; i--)
+    {
+        frac[i] = (char)('0' + rem % 10);
+        rem /= 10;
+    }
+
+    append(frac, 6);
+}
+
+/**
+ * @brief      Appends an unsigned integer in decimal.
+ *
+ * @param[in]  num   The number
+ */
+void LogBuffer::appendUInt(unsigned long long num)
+{
+    char digits[20];
+    int i = 20;
+
+    do
+    {
+        digits[--i] = (char)('0' + num % 10);
+        num /= 10;
+    } while (num > 0);
+
+    append(digits + i, 20 - i);
+}
+
+/**
+ * @brief      Appends an unsigned integer in the same 0x%08x format as 
+ *             uintToHexStr().
+ *
+ * @param[in]  num   The number
+ */
+void LogBuffer::appendHex(unsigned num)
+{
+    const char *HEX_DIGITS = "0123456789abcdef";
+    char digits[10] = { '0', 'x' };
+
+    for (int i = 9; i >= 2; i--)
+    {
+        digits[i] = HEX_DIGITS[num & 0xf];
+        num >>= 4;
+    }
+
+    append(digits, 10);
+}
+
+/**
+ * @brief      Appends a null-terminated string.
+ *
+ * @param[in]  str   The string
+ */
+void LogBuffer::append(const char *str)
+{
+    append(str, strlen(str));
+}
+
+/**
+ * @brief      Appends a string.
+ *
+ * @param[in]  str   The string
+ */
+void LogBuffer::append(const std::string &str)
+{
+    append(str.data(), str.length());
+}
+
+/**
+ * @brief      Appends a single character.
+ *
+ * @param[in]  c     The character
+ */
+void LogBuffer::append(char c)
+{
+    append(&c, 1);
+}
+
+/**
+ * @brief      Appends n characters, truncating at the buffer capacity.
+ *
+ * @param[in]  str   The characters
+ * @param[in]  n     The number of characters
+ */
+void LogBuffer::append(const char *str, size_t n)
+{
+    if (n > LOG_BUFFER_SIZE - this->len)
+    {
+        n = LOG_BUFFER_SIZE - this->len;
+    }
+
+    memcpy(this->buf + this->len, str, n);
+    this->len += n;
+}
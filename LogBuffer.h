@@ -0,0 +1,77 @@
+/**
+ * @file LogBuffer.h
+ * 
+ * @brief Definition file for LogBuffer class
+ * 
+ * @details Specifies all member methods of the LogBuffer class, a fixed-size 
+ *          character buffer used to format log lines without heap allocation
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of LogBuffer class
+ * 
+ * @note Build with -DSIM_LOG_INSTRUCTIONS=0 to compile out per-instruction 
+ *       log lines entirely.
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef LOG_BUFFER_H
+#define LOG_BUFFER_H
+
+#ifndef SIM_LOG_INSTRUCTIONS
+#define SIM_LOG_INSTRUCTIONS 1
+#endif
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <cstddef>      // size_t
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const size_t LOG_BUFFER_SIZE = 256;
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class LogBuffer
+{
+public:
+    LogBuffer();
+
+    void appendTime(unsigned long long usec);
+    void appendUInt(unsigned long long num);
+    void appendHex(unsigned num);
+    void append(const char *str);
+    void append(const std::string &str);
+    void append(char c);
+
+    /**
+     * @brief      Empties the buffer for reuse.
+     */
+    inline void clear() { this->len = 0; }
+
+    /**
+     * @brief      Gets the formatted characters.
+     *
+     * @return     Pointer to the (non null-terminated) characters.
+     */
+    inline const char *data() const { return this->buf; }
+
+    /**
+     * @brief      Gets the number of formatted characters.
+     *
+     * @return     The length.
+     */
+    inline size_t size() const { return this->len; }
+private:
+    void append(const char *str, size_t n);
+
+    char buf[LOG_BUFFER_SIZE];
+    size_t len;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // LOG_BUFFER_H
+//
@@ -0,0 +1,275 @@
+/**
+ * @file MappedLog.cpp
+ * 
+ * @brief Implementation file for MappedLog class
+ * 
+ * @details Implements all member methods of MappedLog class. The file is
+ *          split into windows of a fixed size; the first writer to reach a
+ *          window preallocates and maps it, and the writer that fills its
+ *          last byte unmaps it again, so a window stays mapped only while
+ *          some line in it is still being copied in.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          acquire() frees the window's slot if it cannot map the window
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of MappedLog class
+ * 
+ * @note Requries MappedLog.h
+ */
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "MappedLog.h"
+
+#include <cstring>      // memcpy
+#include <algorithm>    // std::min
+#include <thread>       // std::this_thread::yield
+#include <fcntl.h>      // open, posix_fallocate
+#include <unistd.h>     // ftruncate, fsync, fdatasync, close
+#include <sys/mman.h>   // mmap, munmap, msync
+#include <sys/stat.h>   // fstat
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs a closed log.
+ */
+MappedLog::MappedLog() :
+    fd(-1),
+    policy(SYNC_NONE),
+    windowBytes(DEFAULT_LOG_WINDOW_MB << 20),
+    start(0),
+    tail(0)
+{
+    for (logWindow &slot: this->slots)
+    {
+        slot.number.store(0);
+        slot.base.store(nullptr);
+        slot.filled.store(0);
+    }
+}
+
+/**
+ * @brief      Destroys the object, closing the log file if it is open.
+ */
+MappedLog::~MappedLog()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::string &error)
+    {
+        // the log is as complete as it can be made
+    }
+}
+
+/**
+ * @brief      Opens a log file for appending.
+ *
+ * @param[in]  path      The log file path
+ * @param[in]  windowMB  The size of the mapped windows in megabytes
+ * @param[in]  policy    When the log is synced to disk
+ */
+void MappedLog::open(const std::string &path, unsigned long windowMB, LogSyncPolicy policy)
+{
+    struct stat info;
+
+    this->fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (this->fd < 0 || fstat(this->fd, &info) != 0)
+    {
+        throw std::string("Error: cannot log to file - unable to open log file");
+    }
+
+    this->policy = policy;
+    this->windowBytes = (unsigned long long) windowMB << 20;
+    this->start = (unsigned long long) info.st_size;
+    this->tail.store(this->start);
+}
+
+/**
+ * @brief      Appends characters to the log. May be called by several threads
+ *             at once; each call's characters stay together in the file.
+ *
+ * @param[in]  data  The characters to log
+ * @param[in]  len   The number of characters
+ */
+void MappedLog::append(const char *data, size_t len)
+{
+    unsigned long long offset;
+
+    if (len == 0)
+    {
+        return;
+    }
+
+    offset = this->tail.fetch_add(len);
+
+    // a line may straddle the end of a window
+    while (len > 0)
+    {
+        unsigned long long window = offset / this->windowBytes;
+        unsigned long long within = offset % this->windowBytes;
+        size_t part = (size_t) std::min((unsigned long long) len, this->windowBytes - within);
+
+        memcpy(acquire(window) + within, data, part);
+        release(window, part);
+
+        offset += part;
+        data += part;
+        len -= part;
+    }
+}
+
+/**
+ * @brief      Syncs the log to disk if the sync policy is "Flush". The mapped
+ *             windows are part of the file, so other readers already see
+ *             everything logged.
+ */
+void MappedLog::flush()
+{
+    if (isOpen() && this->policy == SYNC_FLUSH)
+    {
+        fdatasync(this->fd);
+    }
+}
+
+/**
+ * @brief      Closes the log file once every writer has finished: unmaps the
+ *             open windows, cuts the file back to the logged size and syncs
+ *             it unless the sync policy is "None".
+ */
+void MappedLog::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    for (logWindow &slot: this->slots)
+    {
+        char *base = slot.base.load();
+
+        if (base != nullptr)
+        {
+            munmap(base, this->windowBytes);
+            slot.base.store(nullptr);
+        }
+
+        slot.number.store(0);
+        slot.filled.store(0);
+    }
+
+    int status = ftruncate(this->fd, (off_t) this->tail.load());
+
+    if (this->policy != SYNC_NONE)
+    {
+        fsync(this->fd);
+    }
+
+    ::close(this->fd);
+    this->fd = -1;
+
+    if (status != 0)
+    {
+        throw std::string("Error: cannot close log file - unable to truncate log file");
+    }
+}
+
+/**
+ * @brief      Gets the mapping of a window, mapping it first if no other
+ *             writer has. Waits if the window's slot is still held by the
+ *             window MAPPED_LOG_SLOTS before it, or while another writer maps
+ *             the window.
+ *
+ * @param[in]  window  The window number
+ *
+ * @return     The start of the window in memory.
+ */
+char* MappedLog::acquire(unsigned long long window)
+{
+    logWindow &slot = this->slots[window % MAPPED_LOG_SLOTS];
+
+    for (;;)
+    {
+        unsigned long long number = slot.number.load();
+
+        if (number == window + 1)
+        {
+            char *base = slot.base.load();
+
+            if (base != nullptr)
+            {
+                return base;
+            }
+        }
+        else if (number == 0 && slot.number.compare_exchange_weak(number, window + 1))
+        {
+            unsigned long long offset = window * this->windowBytes;
+            void *base;
+
+            // on failure the slot is given back, so that writers waiting for 
+            // the window claim it again and fail themselves instead of spinning
+            if (posix_fallocate(this->fd, (off_t) offset, (off_t) this->windowBytes) != 0)
+            {
+                slot.number.store(0);
+                throw std::string("Error: cannot log to file - unable to allocate log file");
+            }
+
+            base = mmap(nullptr, this->windowBytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        this->fd, (off_t) offset);
+
+            if (base == MAP_FAILED)
+            {
+                slot.number.store(0);
+                throw std::string("Error: cannot log to file - unable to map log file");
+            }
+
+#ifdef MADV_POPULATE_WRITE
+            // one call instead of a write fault per page; older kernels
+            // refuse it and fault the pages in as they are written
+            madvise(base, this->windowBytes, MADV_POPULATE_WRITE);
+#endif
+
+            // whatever the file held before it was opened counts as filled
+            slot.filled.store(offset < this->start ? this->start - offset : 0);
+            slot.base.store((char*) base);
+
+            return (char*) base;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief      Records that bytes of a window have been copied in, and unmaps
+ *             the window once it is full, syncing it first if the sync policy
+ *             is "Window".
+ *
+ * @param[in]  window  The window number
+ * @param[in]  bytes   The number of bytes copied in
+ */
+void MappedLog::release(unsigned long long window, unsigned long long bytes)
+{
+    logWindow &slot = this->slots[window % MAPPED_LOG_SLOTS];
+
+    if (slot.filled.fetch_add(bytes) + bytes == this->windowBytes)
+    {
+        char *base = slot.base.load();
+
+        if (this->policy == SYNC_WINDOW)
+        {
+            msync(base, this->windowBytes, MS_SYNC);
+        }
+
+        munmap(base, this->windowBytes);
+        slot.base.store(nullptr);
+        slot.number.store(0);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file MappedLog.h
+ * 
+ * @brief Definition file for MappedLog class
+ * 
+ * @details Specifies all member methods of the MappedLog class, a log file
+ *          sink that writes through memory-mapped windows of the file instead
+ *          of a stream. Writers reserve the byte range for a line by adding
+ *          its length to the end of the log and copy the line straight into
+ *          the mapping, so any number of threads can log at once without a
+ *          mutex. The file is preallocated a window at a time and cut back to
+ *          the logged size when the log is closed.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of MappedLog class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef MAPPED_LOG_H
+#define MAPPED_LOG_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <atomic>       // end of log and window slots
+#include <cstddef>      // size_t
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum LogSyncPolicy {SYNC_NONE, SYNC_EXIT, SYNC_WINDOW, SYNC_FLUSH, NUM_SYNC_POLICIES};
+
+const std::string LOG_SYNC_NAMES[NUM_SYNC_POLICIES] = {
+    "None", "Exit", "Window", "Flush"
+};
+
+const unsigned long DEFAULT_LOG_WINDOW_MB = 16;
+const unsigned MAPPED_LOG_SLOTS = 64;      // windows mapped at once, at most
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+
+/**
+ * Struct to hold one mapped window of the log file. Window w of the file uses
+ * slot w % MAPPED_LOG_SLOTS, and gives it back once all its bytes are filled.
+ */
+struct logWindow
+{
+    std::atomic<unsigned long long> number;     // window number + 1, 0 if free
+    std::atomic<char*> base;                    // set once the window is mapped
+    std::atomic<unsigned long long> filled;     // bytes copied in
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class MappedLog
+{
+public:
+    MappedLog();
+    ~MappedLog();
+
+    void open(const std::string &path, unsigned long windowMB, LogSyncPolicy policy);
+    void append(const char *data, size_t len);
+    void flush();
+    void close();
+
+    /**
+     * @brief      Determines if the log file is open.
+     *
+     * @return     True if open, False otherwise.
+     */
+    inline bool isOpen() const { return this->fd >= 0; }
+
+    /**
+     * @brief      Gets the size of the log, including lines still being
+     *             copied in.
+     *
+     * @return     The size in bytes.
+     */
+    inline unsigned long long getSize() const { return this->tail.load(); }
+private:
+    char* acquire(unsigned long long window);
+    void release(unsigned long long window, unsigned long long bytes);
+
+    int fd;
+    LogSyncPolicy policy;
+    unsigned long long windowBytes;
+    unsigned long long start;                   // size of the file when opened
+    std::atomic<unsigned long long> tail;       // end of the reserved bytes
+    logWindow slots[MAPPED_LOG_SLOTS];
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // MAPPED_LOG_H
+//
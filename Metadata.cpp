@@ -5,6 +5,48 @@
  * 
  * @details Implements all member methods of Metadata class
  * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Parse a chunk on the calling thread if its thread cannot be 
+ *          created
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          - Accept code T only with descriptors fork, exit and join, and 
+ *            those descriptors only with code T
+ *          - Check the fork/join structure of every process 
+ *            (validateThreads())
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Record process boundaries and I/O counts while parsing each chunk
+ *          and merge them into the process index (indexProcesses())
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Profile metadata parsing
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Stop storing semaphore pointers in instructions, which are now 
+ *          shared between simulations
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Tokenize chunks with the vectorized MetadataScanner and parse 
+ *          instructions directly from the token offsets
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          - Parse the metadata body in chunks split at ';' boundaries on 
+ *            parallel threads and merge the per-chunk buffers in order.
+ *          - Resolve descriptor cycle times and semaphores once per file 
+ *            instead of once per instruction.
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Append parsed instructions to the instruction arena
+ * 
  * @version 1.01
  *          Adam Landis (24 April 2019)
  *          Change signature of parseMetadataFile() to have no parameters and 
@@ -21,6 +63,10 @@
 //
 #include "Metadata.h"
 #include "helpers.h"
+#include "MetadataScanner.h"
+#include "Profiler.h"
+
+#include <cstring>      // memchr
 //
 // Class Member Implementation /////////////////////////////////////////////////
 //
@@ -73,86 +119,392 @@ void Metadata::validateMetadataFile(std::ifstream& metadataFile)
 }
 
 /**
- * Parses the contents of a metadata file
+ * Parses the contents of a metadata file. The body between header and footer 
+ * is split into chunks at ';' boundaries which are parsed concurrently into 
+ * per-chunk instruction buffers, then appended to the arena in file order.
  *
- * @return  a queue containing metadata instructions
+ * @return  None
  */
 void Metadata::parseMetadataFile()
 {
-    std::ifstream metadataFile(filename.c_str(), std::ios::in);
+    PROFILE_SCOPE(PHASE_PARSE);
 
-    std::string tempLine;
-    std::string tempInstr;
-    bool isLastLine = false;
+    std::ifstream metadataFile(filename.c_str(), std::ios::in | std::ios::binary);
+    std::string text;
+
+    metadataFile.seekg(0, std::ios::end);
+    text.resize((size_t) metadataFile.tellg());
+    metadataFile.seekg(0, std::ios::beg);
+    metadataFile.read(&text[0], text.size());
+    metadataFile.close();
+
+    // Ignore header
+    size_t bodyStart = text.find('\n');
+    bodyStart = (bodyStart == std::string::npos) ? text.size() : bodyStart + 1;
+
+    // Body ends at the footer line, or at end of file if there is none
+    size_t bodyEnd = bodyStart;
+    while (bodyEnd < text.size() && 
+           text.compare(bodyEnd, METADATA_FOOTER.size(), METADATA_FOOTER) != 0)
+    {
+        bodyEnd = text.find('\n', bodyEnd);
+        bodyEnd = (bodyEnd == std::string::npos) ? text.size() : bodyEnd + 1;
+    }
+
+    // Instructions end at the first '.'
+    size_t dot = text.find('.', bodyStart);
+    if (dot != std::string::npos && dot < bodyEnd)
+    {
+        bodyEnd = dot;
+    }
+
+    resolveDescriptorSettings();
+
+    // Split the body into chunks ending just after a ';'
+    unsigned numChunks = (unsigned)((bodyEnd - bodyStart) / MIN_PARSE_CHUNK_SIZE);
+    unsigned numCPUs = (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+
+    numChunks = std::max(1u, std::min(numChunks, std::max(1u, numCPUs)));
 
-    getline(metadataFile, tempLine); // Ignore header
+    std::vector<parseChunk> chunks(numChunks);
+    size_t chunkStart = bodyStart;
 
-    while (!metadataFile.eof() && tempLine != METADATA_FOOTER && ! isLastLine)
+    for (unsigned c = 0; c < numChunks; c++)
     {
-        getline(metadataFile, tempLine);
+        size_t chunkEnd = bodyEnd;
 
-        if (tempLine != METADATA_FOOTER)
+        if (c + 1 < numChunks)
         {
-            tempLine = stripSpaces(tempLine);
-            size_t start = 0;
-            size_t end = 0;
+            chunkEnd = bodyStart + (bodyEnd - bodyStart) * (c + 1) / numChunks;
+            chunkEnd = text.find(';', std::max(chunkEnd, chunkStart));
+            chunkEnd = (chunkEnd == std::string::npos || chunkEnd >= bodyEnd) ? 
+                       bodyEnd : chunkEnd + 1;
+        }
+
+        chunks[c].metadata = this;
+        chunks[c].begin = text.data() + chunkStart;
+        chunks[c].end = text.data() + chunkEnd;
+        chunks[c].isLast = (c + 1 == numChunks);
+        chunkStart = chunkEnd;
+    }
+
+    if (numChunks == 1)
+    {
+        parseChunkThread(&chunks[0]);
+    }
+    else
+    {
+        std::vector<pthread_t> tids(numChunks);
+        std::vector<bool> started(numChunks);
+
+        for (unsigned c = 0; c < numChunks; c++)
+        {
+            started[c] = (pthread_create(&tids[c], NULL, parseChunkThread, 
+                                         (void*)&chunks[c]) == 0);
 
-            do
+            // without a thread of its own, the chunk is parsed right here
+            if (!started[c])
             {
-                end = tempLine.find(';', start);
+                parseChunkThread(&chunks[c]);
+            }
+        }
+
+        for (unsigned c = 0; c < numChunks; c++)
+        {
+            if (started[c])
+            {
+                pthread_join(tids[c], NULL);
+            }
+        }
+    }
+
+    size_t total = this->instrArena.size();
+
+    for (unsigned c = 0; c < numChunks; c++)
+    {
+        if (chunks[c].failed)
+        {
+            throw chunks[c].error;
+        }
+
+        total += chunks[c].instrs.size();
+    }
 
-                // if ';' not found but there are more chars left
-                if ((end == std::string::npos) && (start < tempLine.length()))
+    this->instrArena.reserve(total);
+
+    for (unsigned c = 0; c < numChunks; c++)
+    {
+        this->instrArena.insert(this->instrArena.end(), 
+                                chunks[c].instrs.begin(), chunks[c].instrs.end());
+    }
+
+    indexProcesses(chunks);
+    validateThreads(chunks);
+}
+
+/**
+ * @brief      Builds the process index from the boundaries recorded by each
+ *             chunk. A process runs from an A{begin} to the next A{finish}, or
+ *             to the end of the file if there is none; an A{begin} inside a 
+ *             process is one of its instructions, and instructions outside 
+ *             any process are ignored.
+ *
+ * @param[in]  chunks  The parsed chunks, in file order, whose instructions 
+ *                     end the arena
+ */
+void Metadata::indexProcesses(const std::vector<parseChunk> &chunks)
+{
+    unsigned base = this->instrArena.size();
+    unsigned ioBase = 0;
+    unsigned ioBegin = 0;
+    bool inProcess = false;
+    processSpan span = processSpan();
+
+    for (const parseChunk &chunk: chunks)
+    {
+        base -= chunk.instrs.size();
+    }
+
+    for (const parseChunk &chunk: chunks)
+    {
+        for (const processMark &mark: chunk.marks)
+        {
+            unsigned index = base + mark.index;
+            unsigned ioBefore = ioBase + mark.ioBefore;
+
+            if (mark.isBegin && !inProcess)
+            {
+                span.offset = index + 1;
+                span.tickets = this->instrArena[index].getNumCycles();
+                ioBegin = ioBefore;
+                inProcess = true;
+            }
+            else if (!mark.isBegin && inProcess)
+            {
+                span.numInstr = index - span.offset;
+                span.numIOInstr = ioBefore - ioBegin;
+                this->processSpans.push_back(span);
+                inProcess = false;
+            }
+        }
+
+        base += chunk.instrs.size();
+        ioBase += chunk.numIO;
+    }
+
+    if (inProcess)
+    {
+        span.numInstr = base - span.offset;
+        span.numIOInstr = ioBase - ioBegin;
+        this->processSpans.push_back(span);
+    }
+}
+
+/**
+ * @brief      Checks the fork/join regions of every process from the T 
+ *             instructions recorded by each chunk. A T{fork} starts a thread
+ *             that must end with a T{exit} before any other T instruction and
+ *             before the end of its process, and a T{join} must follow a 
+ *             thread of the main thread. T instructions outside any process
+ *             are ignored like the rest.
+ *
+ * @param[in]  chunks  The parsed chunks, in file order, whose instructions 
+ *                     end the arena
+ */
+void Metadata::validateThreads(const std::vector<parseChunk> &chunks)
+{
+    unsigned base = this->instrArena.size();
+    std::vector<processSpan>::const_iterator span = this->processSpans.begin();
+    bool inThread = false, forked = false;
+
+    for (const parseChunk &chunk: chunks)
+    {
+        base -= chunk.instrs.size();
+    }
+
+    for (const parseChunk &chunk: chunks)
+    {
+        for (unsigned mark: chunk.threadMarks)
+        {
+            unsigned index = base + mark;
+
+            // a process ends with its threads exited
+            while (span != this->processSpans.end() && index >= span->offset + span->numInstr)
+            {
+                if (inThread)
                 {
-                    // look for '.'
-                    end = tempLine.find('.', start);
+                    throw std::string("Error: cannot parse metadata - T{fork} without T{exit}");
+                }
+
+                forked = false;
+                span++;
+            }
 
-                    // if we didn't find '.' either, throw error
-                    if (end == std::string::npos)
+            if (span == this->processSpans.end() || index < span->offset)
+            {
+                continue;
+            }
+
+            switch (this->instrArena[index].getDescId())
+            {
+                case DESC_FORK:
+                    if (inThread)
                     {
-                        throw std::string("Error: cannot parse metadata - missing ';' or '.'");
+                        throw std::string("Error: cannot parse metadata - T{fork} inside a thread");
                     }
 
-                    isLastLine = true;
-                }
+                    inThread = forked = true;
+                    break;
+                case DESC_EXIT:
+                    if (!inThread)
+                    {
+                        throw std::string("Error: cannot parse metadata - T{exit} outside a thread");
+                    }
 
-                tempInstr = tempLine.substr(start, end - start);
+                    inThread = false;
+                    break;
+                default:
+                    if (inThread)
+                    {
+                        throw std::string("Error: cannot parse metadata - T{join} inside a thread");
+                    }
 
-                MetadataInstruction instr = parseMetadataInstruction(tempInstr);
+                    if (!forked)
+                    {
+                        throw std::string("Error: cannot parse metadata - "
+                                          "T{join} outside a fork/join region");
+                    }
 
-                std::string descriptor = instr.getDescriptor();
-                configSetting setting = this->config->getConfigSetting(descriptor);
-                unsigned long cycleTime = strToUnsignedLong(setting.value);
-                instr.setWaitTime(cycleTime);         
+                    forked = false;
+                    break;
+            }
+        }
 
-                if (descriptor == "hard drive")
-                {
-                    instr.setSemPtr(this->semHD);
-                }
-                else if (descriptor == "projector")
-                {
-                    instr.setSemPtr(this->semProj);
-                }
-                else if (descriptor == "keyboard")
-                {
-                    instr.setSemPtr(this->semKB);
-                }
-                else if (descriptor == "monitor")
-                {
-                    instr.setSemPtr(this->semMon);
-                }
-                else if (descriptor == "scanner")
+        base += chunk.instrs.size();
+    }
+
+    if (inThread)
+    {
+        throw std::string("Error: cannot parse metadata - T{fork} without T{exit}");
+    }
+}
+
+/**
+ * @brief      Parses all ';'-separated instructions in a chunk of the metadata
+ *             body into the chunk's buffer, recording the process boundaries,
+ *             I/O instructions and T instructions among them. Token offsets 
+ *             come from the vectorized MetadataScanner; whitespace is ignored.
+ *
+ * @param      chunk  The chunk
+ */
+void Metadata::parseMetadataChunk(parseChunk &chunk)
+{
+    const char *begin = chunk.begin;
+    const char *end = chunk.end;
+    bool isLast = chunk.isLast;
+    std::vector<MetadataInstruction> &instrs = chunk.instrs;
+    MetadataScanner scanner;
+    std::vector<metadataToken> tokens;
+    std::string tempInstr;
+
+    scanner.scan(begin, end - begin, tokens);
+    instrs.reserve(instrs.size() + tokens.size());
+
+    for (size_t k = 0; k < tokens.size(); k++)
+    {
+        const metadataToken &token = tokens[k];
+
+        if (k + 1 == tokens.size())
+        {
+            const char *p = begin + token.end;
+
+            while (p < end && *p != ';')
+            {
+                p++;
+            }
+
+            // a trailing instruction must be the last one, terminated by '.'
+            if (p == end && (!isLast || *end != '.'))
+            {
+                throw std::string("Error: cannot parse metadata - missing ';' or '.'");
+            }
+        }
+
+        if (token.hasSpace)
+        {
+            tempInstr.clear();
+
+            for (size_t i = token.begin; i < token.end; i++)
+            {
+                char c = begin[i];
+
+                if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
                 {
-                    instr.setSemPtr(this->semScan);
+                    tempInstr += c;
                 }
+            }
+
+            instrs.push_back(buildMetadataInstruction(tempInstr.data(), tempInstr.length()));
+        }
+        else
+        {
+            instrs.push_back(buildMetadataInstruction(begin + token.begin, 
+                                                      token.end - token.begin));
+        }
+
+        const MetadataInstruction &instr = instrs.back();
+        char code = instr.getCode();
+
+        if (code == 'A' && (instr.getDescId() == DESC_BEGIN || instr.getDescId() == DESC_FINISH))
+        {
+            processMark mark = {(unsigned) instrs.size() - 1, chunk.numIO, 
+                                instr.getDescId() == DESC_BEGIN};
 
-                mdQueue.push(instr);
-                start = end + 1;
-            } while (end != std::string::npos && start < tempLine.length());
+            chunk.marks.push_back(mark);
+        }
+        else if (code == 'I' || code == 'O')
+        {
+            chunk.numIO++;
+        }
+        else if (code == 'T')
+        {
+            chunk.threadMarks.push_back(instrs.size() - 1);
         }
     }
+}
 
-    metadataFile.close();
+/**
+ * @brief      Parses a single instruction and sets its wait time and 
+ *             semaphore from the resolved descriptor settings.
+ *
+ * @param[in]  instructionStr  The instruction characters (no whitespace)
+ * @param[in]  instrLen        The number of characters
+ *
+ * @return     The metadata instruction
+ */
+MetadataInstruction Metadata::buildMetadataInstruction(const char *instructionStr, 
+                                                       size_t instrLen)
+{
+    MetadataInstruction instr = parseMetadataInstruction(instructionStr, instrLen);
+    Descriptor descId = instr.getDescId();
+
+    instr.setWaitTime(this->cycleTimes[descId]);
+
+    return instr;
+}
+
+/**
+ * @brief      Looks up the cycle time of every descriptor once, 
+ *             so chunk parsing never touches the (non thread-safe) config map.
+ */
+void Metadata::resolveDescriptorSettings()
+{
+    for (unsigned d = 0; d < NUM_DESCRIPTORS; d++)
+    {
+        configSetting setting = this->config->getConfigSetting(DESCRIPTOR_NAMES[d]);
+
+        this->cycleTimes[d] = strToUnsignedLong(setting.value);
+    }
 }
 
 /**
@@ -166,39 +518,64 @@ void Metadata::parseMetadataFile()
  */
 MetadataInstruction Metadata::parseMetadataInstruction(std::string& instructionStr)
 {
-    unsigned long i = 0;
-    unsigned long instrLen = instructionStr.length();
+    return parseMetadataInstruction(instructionStr.data(), instructionStr.length());
+}
+
+/**
+ * Parses a single metadata instruction from a range of characters without 
+ * whitespace
+ *
+ * @param   instructionStr
+ *          The characters containing the instruction to be parsed
+ *
+ * @param   instrLen
+ *          The number of characters
+ *
+ * @return  the parsed metadata instruction
+ */
+MetadataInstruction Metadata::parseMetadataInstruction(const char *instructionStr, 
+                                                       size_t instrLen)
+{
+    size_t i = 0;
 
     char code;
     std::string descriptor;
     std::string numCycles;
 
-    code = instructionStr[i];
+    code = (instrLen > 0) ? instructionStr[i] : '\0';
     validateMetadataCode(code);
 
-    while (instructionStr[++i] == ' ' && i < instrLen);
+    while (++i < instrLen && instructionStr[i] == ' ');
 
-    if (instructionStr[i] != '{')
+    if (i >= instrLen || instructionStr[i] != '{')
     {
         throw std::string("Error: cannot parse metadata - missing start '{'");
     }
 
     ++i;
 
-    unsigned long j = instructionStr.find('}');
+    const char *close = (const char*) memchr(instructionStr + i, '}', instrLen - i);
 
-    if (j == std::string::npos)
+    if (close == NULL)
     {
         throw std::string("Error: cannot parse metadata - missing end '}'");
     }
 
-    descriptor = instructionStr.substr(i, j - i);
+    size_t j = close - instructionStr;
+
+    descriptor.assign(instructionStr + i, j - i);
     if (descriptor == "harddrive") descriptor = "hard drive";
     validateMetadataDescriptor(descriptor);
 
+    // T instructions are exactly the fork, exit and join instructions
+    if ((code == 'T') != (descriptor == "fork" || descriptor == "exit" || descriptor == "join"))
+    {
+        throw std::string("Error: cannot parse metadata - invalid descriptor for code");
+    }
+
     i = j + 1;
 
-    numCycles = instructionStr.substr(i, instrLen - i);
+    numCycles.assign(instructionStr + i, instrLen - i);
     validateMetadataCycles(numCycles);
 
     return MetadataInstruction(code, descriptor, strToUnsignedLong(numCycles));
@@ -343,20 +720,31 @@ std::string Metadata::generateMetadataLogData(MetadataInstruction instr)
     return result;
 }
 
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
 /**
- * @brief      Sets the semaphore pointers.
+ * @brief      Thread that parses one chunk of the metadata body, recording 
+ *             any parse error instead of throwing across the thread boundary.
  *
- * @param      semHD    The HDD semaphore
- * @param      semProj  The PROJ semaphore
- * @param      semKB    The Keyboard semaphore
- * @param      semMon   The Monitor semaphore
- * @param      semScan  The Scanner semaphore
+ * @param      param  The parseChunk to parse
+ *
+ * @return     None
  */
-void Metadata::setSemPtrs(sem_t *semHD, sem_t *semProj, sem_t *semKB, sem_t *semMon, sem_t *semScan)
+void* parseChunkThread(void* param)
 {
-    this->semHD = semHD;
-    this->semProj = semProj;
-    this->semKB = semKB;
-    this->semMon = semMon;
-    this->semScan = semScan;
-}
\ No newline at end of file
+    parseChunk *chunk = (parseChunk*) param;
+
+    try
+    {
+        chunk->metadata->parseMetadataChunk(*chunk);
+    }
+    catch (std::string& e)
+    {
+        chunk->error = e;
+        chunk->failed = true;
+    }
+
+    return 0;
+}
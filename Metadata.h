@@ -5,6 +5,45 @@
  * 
  * @details Specifies all member methods of the Metadata class
  * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Chunks record their T instructions (threadMarks); add 
+ *          validateThreads()
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          Add metadata code T and descriptors fork, exit and join
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Add getFilename()
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add processSpan and processMark structs; chunks record the process
+ *          boundaries they parse and getProcessSpans() returns the merged 
+ *          index
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Remove setSemPtrs() and the semaphore data members
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Add parseMetadataInstruction() overload taking a character range 
+ *          and change buildMetadataInstruction() to take one
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Add parseChunk struct, parseChunkThread(), parseMetadataChunk(), 
+ *          buildMetadataInstruction() and resolveDescriptorSettings() for 
+ *          parallel chunked parsing
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Replace the metadata instruction queue with a contiguous instruction
+ *          arena returned by const reference from getInstrArena()
+ * 
  * @version 1.01
  *          Adam Landis (24 April 2019)
  *          Change signature of parseMetadataFile() to have no parameters
@@ -24,15 +63,68 @@
 // Header Files ////////////////////////////////////////////////////////////////
 // 
 #include <string>
-#include <queue>        // to hold metadata instructions
+#include <vector>       // to hold metadata instructions
 #include <fstream>      // ifstream
+#include <algorithm>    // std::min, std::max
+#include <pthread.h>    // for chunk parsing threads
+#include <unistd.h>     // sysconf
 
 #include "Config.h"
 #include "MetadataInstruction.h"
 //
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const size_t MIN_PARSE_CHUNK_SIZE = 1 << 20;    // bytes per parsing thread
+//
 // Typedefs ////////////////////////////////////////////////////////////////////
 //
-typedef std::queue<MetadataInstruction> metadataQueue;
+typedef std::vector<MetadataInstruction> instructionArena;
+//
+// Class/Struct Definitions ////////////////////////////////////////////////////
+//
+class Metadata;
+
+/**
+ * Struct to hold an A{begin} or A{finish} instruction found in a chunk
+ */
+struct processMark
+{
+    unsigned index;         // in the chunk's instructions
+    unsigned ioBefore;      // I/O instructions in the chunk before it
+    bool isBegin;
+};
+
+/**
+ * Struct to hold one chunk of the metadata body and its parse results
+ */
+struct parseChunk
+{
+    Metadata *metadata;
+    const char *begin, *end;
+    bool isLast;
+    std::vector<MetadataInstruction> instrs;
+    std::vector<processMark> marks;
+    std::vector<unsigned> threadMarks;  // indices of its T instructions
+    unsigned numIO = 0;
+    std::string error;
+    bool failed = false;
+};
+
+/**
+ * Struct to hold the instructions of one process: those between its 
+ * A{begin} and the next A{finish}
+ */
+struct processSpan
+{
+    unsigned offset;        // arena index of the first instruction
+    unsigned numInstr;
+    unsigned numIOInstr;
+    unsigned tickets;       // cycle count of the A{begin}
+};
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+void* parseChunkThread(void* param);
 //
 // Class Definition ////////////////////////////////////////////////////////////
 // 
@@ -43,29 +135,49 @@ public:
 
     void validateMetadataFile(std::ifstream& metadataFile);
     void parseMetadataFile();
+    void parseMetadataChunk(parseChunk &chunk);
+    void indexProcesses(const std::vector<parseChunk> &chunks);
+    void validateThreads(const std::vector<parseChunk> &chunks);
+    MetadataInstruction buildMetadataInstruction(const char *instructionStr, size_t instrLen);
+    void resolveDescriptorSettings();
     MetadataInstruction parseMetadataInstruction(std::string& instructionStr);
+    MetadataInstruction parseMetadataInstruction(const char *instructionStr, size_t instrLen);
     void validateMetadataCode(const char& code);
     void validateMetadataDescriptor(const std::string& descriptor);
     void validateMetadataCycles(const std::string& numCycles);
     void logMetadataFileData(const MetadataInstruction& instr);
     std::string generateMetadataLogData(MetadataInstruction instr);
 
-    void setSemPtrs(sem_t *semHD, sem_t *semProj, sem_t *semKB, sem_t *semMon, sem_t *semScan);
+    /**
+     * @brief      Gets the arena holding every parsed instruction in file 
+     *             order. Processes refer to spans of this arena.
+     *
+     * @return     The instruction arena.
+     */
+    inline const instructionArena& getInstrArena() const { return this->instrArena; }
+
+    /**
+     * @brief      Gets the processes found while parsing, in file order.
+     *
+     * @return     The span of the arena holding each process.
+     */
+    inline const std::vector<processSpan>& getProcessSpans() const { return this->processSpans; }
 
     /**
-     * @brief      Gets the metadata instruction queue.
+     * @brief      Gets the name of the metadata file.
      *
-     * @return     The metadata instruction queue.
+     * @return     The filename.
      */
-    inline metadataQueue getMetadataQueue() const { return this->mdQueue; }
+    inline const std::string& getFilename() const { return this->filename; }
 private:
     std::string filename;
-    metadataQueue mdQueue;
+    instructionArena instrArena;
+    std::vector<processSpan> processSpans;
     Config *config;
     const std::string METADATA_HEADER = "Start Program Meta-Data Code:";
     const std::string METADATA_FOOTER = "End Program Meta-Data Code.";
-    const std::string METADATA_CODES = "SAPIOM";
-    const std::string METADATA_DESCRIPTORS[10] = {
+    const std::string METADATA_CODES = "SAPIOMT";
+    const std::string METADATA_DESCRIPTORS[13] = {
         "begin",
         "finish",
         "hard drive",
@@ -76,8 +188,11 @@ private:
         "allocate",
         "projector",
         "block",
+        "fork",
+        "exit",
+        "join",
     };
-    sem_t *semHD, *semProj, *semKB, *semMon, *semScan;
+    unsigned long cycleTimes[NUM_DESCRIPTORS];
 };
 //
 // Terminating Precompiler Directives
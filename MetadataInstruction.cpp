@@ -5,6 +5,30 @@
  * 
  * @details Implements all member methods of MetadataInstruction class
  * 
+ * @version 1.10
+ *          Adam Landis (19 October 2026)
+ *          appendLogString() names the thread of the executing process and 
+ *          logs T (thread) instructions
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Remove setSemPtr() and getSemPtr()
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          Make getSemPtr() const
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Resolve descriptor id and device once on construction and copy 
+ *          them in the copy constructor and overloaded assignment operator
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          - Add appendLogString() to format log strings into a LogBuffer 
+ *            without allocating; genLogString() now wraps it
+ *          - Return descriptor by const reference from getDescriptor()
+ * 
  * @version 1.05
  *          Adam Landis (7 April 2019)
  *          Update genLogString() for hard drive and projector output
@@ -60,7 +84,29 @@ MetadataInstruction::MetadataInstruction(char code,
     this->descriptor = descriptor;
     this->numCycles = numCycles;
     this->waitTime = 0.0;
-    this->semPtr = NULL;
+    this->descId = NUM_DESCRIPTORS;
+    this->device = DEV_NONE;
+
+    for (unsigned i = 0; i < NUM_DESCRIPTORS; i++)
+    {
+        if (descriptor == DESCRIPTOR_NAMES[i])
+        {
+            this->descId = (Descriptor) i;
+        }
+    }
+
+    switch (this->descId)
+    {
+        case DESC_RUN:        this->device = DEV_PROCESSOR;  break;
+        case DESC_ALLOCATE:
+        case DESC_BLOCK:      this->device = DEV_MEMORY;     break;
+        case DESC_HARD_DRIVE: this->device = DEV_HARD_DRIVE; break;
+        case DESC_KEYBOARD:   this->device = DEV_KEYBOARD;   break;
+        case DESC_SCANNER:    this->device = DEV_SCANNER;    break;
+        case DESC_MONITOR:    this->device = DEV_MONITOR;    break;
+        case DESC_PROJECTOR:  this->device = DEV_PROJECTOR;  break;
+        default:              this->device = DEV_NONE;       break;
+    }
 }
 
 /**
@@ -74,7 +120,8 @@ MetadataInstruction::MetadataInstruction(const MetadataInstruction &obj)
     this->descriptor = obj.descriptor;
     this->numCycles = obj.numCycles;
     this->waitTime = obj.waitTime;
-    this->semPtr = obj.semPtr;
+    this->descId = obj.descId;
+    this->device = obj.device;
 }
 
 /**
@@ -90,7 +137,8 @@ MetadataInstruction& MetadataInstruction::operator=(const MetadataInstruction &r
     this->descriptor = rhs.descriptor;
     this->numCycles = rhs.numCycles;
     this->waitTime = rhs.waitTime;
-    this->semPtr = rhs.semPtr;
+    this->descId = rhs.descId;
+    this->device = rhs.device;
 
     return *this;
 }
@@ -110,16 +158,6 @@ void MetadataInstruction::setWaitTime(unsigned long cycleTime)
     this->waitTime = (float)(this->numCycles * cycleTime);
 }
 
-/**
- * @brief      Sets the semaphore pointer.
- *
- * @param      sem   The semaphore pointer
- */
-void MetadataInstruction::setSemPtr(sem_t *semPtr)
-{
-    this->semPtr = semPtr;
-}
-
 /**
  * @brief      Gets the wait time.
  *
@@ -130,16 +168,6 @@ const float MetadataInstruction::getWaitTime() const
     return this->waitTime;
 }
 
-/**
- * @brief      Gets the semaphore pointer.
- *
- * @return     The semaphore pointer.
- */
-sem_t *MetadataInstruction::getSemPtr()
-{
-    return this->semPtr;
-}
-
 /**
  * @brief      Gets the code.
  *
@@ -155,7 +183,7 @@ const char MetadataInstruction::getCode() const
  *
  * @return     The descriptor.
  */
-const std::string MetadataInstruction::getDescriptor() const
+const std::string& MetadataInstruction::getDescriptor() const
 {
     return this->descriptor;
 }
@@ -198,75 +226,106 @@ const std::string MetadataInstruction::toString() const
  */
 const std::string MetadataInstruction::genLogString(bool isStart, unsigned pid)
 {
-    std::string result;
+    LogBuffer buf;
+
+    appendLogString(buf, isStart, pid);
 
+    return std::string(buf.data(), buf.size());
+}
+
+/**
+ * @brief      Appends the log string for this instruction to a log buffer 
+ *             without allocating
+ *
+ * @param      buf      The log buffer
+ * @param[in]  isStart  Indicates if start
+ * @param[in]  pid      The pid
+ * @param[in]  thread   The thread of the process (0 for its main thread)
+ */
+void MetadataInstruction::appendLogString(LogBuffer &buf, bool isStart, unsigned pid, 
+                                          unsigned thread) const
+{
     if (this->code == 'S')
     {
-        result += "Simulator program ";
-        result += (this->descriptor == "begin") ? "starting" : "ending";
+        buf.append("Simulator program ");
+        buf.append((this->descriptor == "begin") ? "starting" : "ending");
     }
     else if (this->code == 'A')
     {
-        result += "OS: ";
+        buf.append("OS: ");
         
         if (this->descriptor == "begin")
         {
-            result += isStart ? "preparing" : "starting";
+            buf.append(isStart ? "preparing" : "starting");
         }
         else if (this->descriptor == "finish")
         {
-            result += "removing";
+            buf.append("removing");
         }
 
-        result += " process " + std::to_string(pid);
+        buf.append(" process ");
+        buf.appendUInt(pid);
     }
     else
     {
-        result += "Process " + std::to_string(pid) + ": ";
+        buf.append("Process ");
+        buf.appendUInt(pid);
+
+        if (thread != 0)
+        {
+            buf.append(" thread ");
+            buf.appendUInt(thread);
+        }
+
+        buf.append(": ");
 
         if (this->code == 'M')
         {
             if (this->descriptor == "allocate")
             {
-                result += isStart ? "allocating memory" : "memory allocated at";
+                buf.append(isStart ? "allocating memory" : "memory allocated at");
             }
             else if (this->descriptor == "block")
             {
-                result += isStart ? "start" : "end";
-                result += " memory blocking";
+                buf.append(isStart ? "start" : "end");
+                buf.append(" memory blocking");
             }
         }
         else
         {
-            result += isStart ? "start" : "end";
+            buf.append(isStart ? "start" : "end");
             
             if (this->code == 'P')
             {
-                result += " processing action";
+                buf.append(" processing action");
+            }
+            else if (this->code == 'T')
+            {
+                buf.append((this->descId == DESC_JOIN) ? " join" : " thread");
             }
             else
             {
-                result += " " + this->descriptor + " ";
+                buf.append(' ');
+                buf.append(this->descriptor);
+                buf.append(' ');
                 
                 if (this->code == 'I' || this->code == 'O')
                 {
-                    result += (this->code == 'I') ? "input" : "output";
+                    buf.append((this->code == 'I') ? "input" : "output");
 
                     if (isStart)
                     {
                         if (this->descriptor == "hard drive")
                         {
-                            result += " on HDD ";
+                            buf.append(" on HDD ");
                         }
                         else if (this->descriptor == "projector")
                         {
-                            result += " on PROJ ";
+                            buf.append(" on PROJ ");
                         }
                     }
                 }
             }
         }
     }
-
-    return result;
-}
\ No newline at end of file
+}
@@ -5,6 +5,29 @@
  * 
  * @details Specifies all member methods of the MetadataInstruction class
  * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          - Add DESC_FORK, DESC_EXIT and DESC_JOIN for T (thread) 
+ *            instructions
+ *          - appendLogString() takes the thread of the executing process
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          Remove data member semPtr and its setter/getter; device semaphores 
+ *          belong to each Simulation so instructions can be shared between 
+ *          simulations
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add Descriptor and Device enums and inline getters getDescId() and
+ *          getDevice() so hot paths can classify instructions without string 
+ *          comparisons
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          - Add appendLogString() method prototype
+ *          - Return descriptor by const reference from getDescriptor()
+ * 
  * @version 1.04
  *          Adam Landis (7 April 2019)
  *          - Add inclusion of semaphore.h header
@@ -39,7 +62,29 @@
 // Header Files ////////////////////////////////////////////////////////////////
 // 
 #include <string>
-#include <semaphore.h>
+
+#include "LogBuffer.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum Descriptor {DESC_BEGIN, DESC_FINISH, DESC_HARD_DRIVE, DESC_KEYBOARD, 
+                 DESC_SCANNER, DESC_MONITOR, DESC_RUN, DESC_ALLOCATE, 
+                 DESC_PROJECTOR, DESC_BLOCK, DESC_FORK, DESC_EXIT, 
+                 DESC_JOIN, NUM_DESCRIPTORS};
+
+enum Device {DEV_PROCESSOR, DEV_MEMORY, DEV_HARD_DRIVE, DEV_KEYBOARD, 
+             DEV_SCANNER, DEV_MONITOR, DEV_PROJECTOR, NUM_DEVICES, DEV_NONE};
+
+const std::string DESCRIPTOR_NAMES[NUM_DESCRIPTORS] = {
+    "begin", "finish", "hard drive", "keyboard", "scanner", 
+    "monitor", "run", "allocate", "projector", "block", "fork", "exit", 
+    "join"
+};
+
+const std::string DEVICE_NAMES[NUM_DEVICES] = {
+    "Processor", "Memory", "Hard drive", "Keyboard", 
+    "Scanner", "Monitor", "Projector"
+};
 //
 // Class Definition ////////////////////////////////////////////////////////////
 // 
@@ -51,21 +96,36 @@ public:
     MetadataInstruction& operator=(const MetadataInstruction &rhs);
     ~MetadataInstruction();
     void setWaitTime(unsigned long cycleTime);
-    void setSemPtr(sem_t *semPtr);
     const float getWaitTime() const;
-    sem_t *getSemPtr();
     const char getCode() const;
-    const std::string getDescriptor() const;
+    const std::string& getDescriptor() const;
     const unsigned long getNumCycles() const;
     const std::string toString() const;
     const std::string genLogString(bool isStart, unsigned pid);
+    void appendLogString(LogBuffer &buf, bool isStart, unsigned pid, 
+                         unsigned thread = 0) const;
+
+    /**
+     * @brief      Gets the descriptor as an enum value.
+     *
+     * @return     The descriptor id (NUM_DESCRIPTORS if unknown).
+     */
+    inline Descriptor getDescId() const { return this->descId; }
+
+    /**
+     * @brief      Gets the device used by the instruction.
+     *
+     * @return     The device (DEV_NONE for S, A and T instructions).
+     */
+    inline Device getDevice() const { return this->device; }
 private:
     char code;
     std::string descriptor;
+    Descriptor descId;
+    Device device;
     unsigned long numCycles;
     std::string logString;
     float waitTime;
-    sem_t *semPtr;
 };
 //
 // Terminating Precompiler Directives
@@ -0,0 +1,243 @@
+/**
+ * @file MetadataScanner.cpp
+ * 
+ * @brief Implementation file for MetadataScanner class
+ * 
+ * @details Implements all member methods of MetadataScanner class. Scanning 
+ *          runs in two stages: classify() compares whole vectors of bytes 
+ *          against the delimiter and whitespace characters and packs the 
+ *          results into bitmaps, then scan() walks the delimiter bitmap with 
+ *          bit tricks to emit trimmed token offsets.
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Keep empty tokens so the parser rejects them
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Use the scalar classifier when SIM_SIMD is 0
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of MetadataScanner class
+ * 
+ * @note Requries MetadataScanner.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "MetadataScanner.h"
+
+#if SIM_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif SIM_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+MetadataScanner::MetadataScanner() {}
+
+/**
+ * @brief      Tokenizes text into ';'-separated instruction tokens. Every 
+ *             ';' ends a token, which is empty (begin == end) if only 
+ *             whitespace precedes it; the text after the last ';' forms a 
+ *             final token if it is not blank.
+ *
+ * @param[in]  text    The text to scan
+ * @param[in]  len     The length of the text
+ * @param      tokens  The vector to append the token offsets to
+ */
+void MetadataScanner::scan(const char *text, size_t len, std::vector<metadataToken> &tokens)
+{
+    size_t start = 0;
+
+    classify(text, len);
+
+    for (size_t w = 0; w < this->sepBits.size(); w++)
+    {
+        uint64_t bits = this->sepBits[w];
+
+        while (bits != 0)
+        {
+            size_t sep = w * 64 + __builtin_ctzll(bits);
+            metadataToken token;
+
+            token.begin = skipSpace(start, sep);
+            token.end = skipSpaceBack(sep, token.begin);
+            token.hasSpace = anySpace(token.begin, token.end);
+            tokens.push_back(token);
+
+            start = sep + 1;
+            bits &= bits - 1;
+        }
+    }
+
+    size_t begin = skipSpace(start, len);
+
+    if (begin < len)
+    {
+        metadataToken token;
+
+        token.begin = begin;
+        token.end = skipSpaceBack(len, begin);
+        token.hasSpace = anySpace(token.begin, token.end);
+        tokens.push_back(token);
+    }
+}
+
+/**
+ * @brief      Builds the delimiter and whitespace bitmaps for the text.
+ *
+ * @param[in]  text  The text
+ * @param[in]  len   The length of the text
+ */
+void MetadataScanner::classify(const char *text, size_t len)
+{
+    size_t numWords = (len + 63) / 64;
+    size_t i = 0;
+
+    this->sepBits.assign(numWords, 0);
+    this->spaceBits.assign(numWords, 0);
+
+#if SIM_SIMD && defined(__AVX2__)
+    const __m256i semi = _mm256_set1_epi8(';');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(text + i));
+        uint64_t sep = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, semi));
+        __m256i ws = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+        uint64_t spc = (uint32_t) _mm256_movemask_epi8(ws);
+
+        this->sepBits[i / 64] |= sep << (i % 64);
+        this->spaceBits[i / 64] |= spc << (i % 64);
+    }
+#elif SIM_SIMD && defined(__SSE2__)
+    const __m128i semi = _mm_set1_epi8(';');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(text + i));
+        uint64_t sep = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(v, semi));
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+        uint64_t spc = (uint32_t) _mm_movemask_epi8(ws);
+
+        this->sepBits[i / 64] |= sep << (i % 64);
+        this->spaceBits[i / 64] |= spc << (i % 64);
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        char c = text[i];
+        uint64_t bit = (uint64_t) 1 << (i % 64);
+
+        if (c == ';')
+        {
+            this->sepBits[i / 64] |= bit;
+        }
+        else if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            this->spaceBits[i / 64] |= bit;
+        }
+    }
+}
+
+/**
+ * @brief      Determines if the byte at pos is whitespace.
+ *
+ * @param[in]  pos   The position
+ *
+ * @return     True if whitespace, False otherwise.
+ */
+bool MetadataScanner::isSpace(size_t pos) const
+{
+    return (this->spaceBits[pos / 64] >> (pos % 64)) & 1;
+}
+
+/**
+ * @brief      Finds the first non-whitespace position in [pos, end).
+ *
+ * @param[in]  pos   The start position
+ * @param[in]  end   The end position
+ *
+ * @return     The position found, or end if all whitespace
+ */
+size_t MetadataScanner::skipSpace(size_t pos, size_t end) const
+{
+    while (pos < end)
+    {
+        uint64_t nonSpace = ~this->spaceBits[pos / 64] >> (pos % 64);
+
+        if (nonSpace != 0)
+        {
+            pos += __builtin_ctzll(nonSpace);
+            return pos < end ? pos : end;
+        }
+
+        pos = (pos / 64 + 1) * 64;
+    }
+
+    return end;
+}
+
+/**
+ * @brief      Finds the end of the last non-whitespace byte in [begin, pos).
+ *
+ * @param[in]  pos    The end position
+ * @param[in]  begin  The start position (must be non-whitespace)
+ *
+ * @return     One past the last non-whitespace position
+ */
+size_t MetadataScanner::skipSpaceBack(size_t pos, size_t begin) const
+{
+    while (pos > begin && isSpace(pos - 1))
+    {
+        pos--;
+    }
+
+    return pos;
+}
+
+/**
+ * @brief      Determines if any byte in [begin, end) is whitespace.
+ *
+ * @param[in]  begin  The start position
+ * @param[in]  end    The end position
+ *
+ * @return     True if whitespace was found, False otherwise.
+ */
+bool MetadataScanner::anySpace(size_t begin, size_t end) const
+{
+    while (begin < end)
+    {
+        size_t n = std::min<size_t>(64 - begin % 64, end - begin);
+        uint64_t mask = (n == 64) ? ~(uint64_t) 0 : (((uint64_t) 1 << n) - 1);
+
+        if ((this->spaceBits[begin / 64] >> (begin % 64)) & mask)
+        {
+            return true;
+        }
+
+        begin += n;
+    }
+
+    return false;
+}
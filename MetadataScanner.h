@@ -0,0 +1,75 @@
+/**
+ * @file MetadataScanner.h
+ * 
+ * @brief Definition file for MetadataScanner class
+ * 
+ * @details Specifies all member methods of the MetadataScanner class, a 
+ *          vectorized tokenizer that locates ';' delimiters and whitespace in 
+ *          metadata text 16-32 bytes at a time and produces the offsets of 
+ *          each instruction token
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add the SIM_SIMD switch
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of MetadataScanner class
+ * 
+ * @note Uses AVX2 when the compiler targets it (e.g. -mavx2), SSE2 otherwise,
+ *       and a scalar fallback when neither is available or SIM_SIMD is 
+ *       defined as 0.
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef METADATA_SCANNER_H
+#define METADATA_SCANNER_H
+
+#ifndef SIM_SIMD
+#define SIM_SIMD 1
+#endif
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <vector>
+#include <cstddef>      // size_t
+#include <stdint.h>     // uint64_t
+#include <algorithm>    // std::min
+//
+// Class/Struct Definitions ////////////////////////////////////////////////////
+//
+/**
+ * Struct to hold the offsets of one instruction token, trimmed of leading and 
+ * trailing whitespace (begin == end for an empty token)
+ */
+struct metadataToken
+{
+    size_t begin;
+    size_t end;
+    bool hasSpace;      // whitespace inside the token (e.g. "hard drive")
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class MetadataScanner
+{
+public:
+    MetadataScanner();
+
+    void scan(const char *text, size_t len, std::vector<metadataToken> &tokens);
+private:
+    void classify(const char *text, size_t len);
+    bool isSpace(size_t pos) const;
+    size_t skipSpace(size_t pos, size_t end) const;
+    size_t skipSpaceBack(size_t pos, size_t begin) const;
+    bool anySpace(size_t begin, size_t end) const;
+
+    std::vector<uint64_t> sepBits;      // 1 bit per byte: ';'
+    std::vector<uint64_t> spaceBits;    // 1 bit per byte: ' ', '\t', '\r', '\n'
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // METADATA_SCANNER_H
+//
@@ -5,6 +5,12 @@
  * 
  * @details Implements all member methods of PCB class
  * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Update constructors, copy constructor, overloaded assignment 
+ *          operator and stream insertion operator for new data members 
+ *          tickets and remCycles
+ * 
  * @version 1.05
  *          - Update copy contructor and overloaded assignment operator to copy
  *            numInstr and numIOInstr data member values
@@ -54,7 +60,15 @@
 /**
  * @brief      Constructs the object (default).
  */
-PCB::PCB() : pid(0), pc(0), numInstr(0), numIOInstr(0), state(START) {}
+PCB::PCB() : 
+    pid(0), 
+    pc(0), 
+    numInstr(0), 
+    numIOInstr(0), 
+    tickets(0), 
+    remCycles(0), 
+    state(START) 
+{}
 
 /**
  * @brief      Constructs the PCB object (parameterized).
@@ -64,6 +78,8 @@ PCB::PCB(unsigned int pid, unsigned int numInstr, unsigned int numIOInstr) :
     pc(0), 
     numInstr(numInstr), 
     numIOInstr(numIOInstr), 
+    tickets(0), 
+    remCycles(0), 
     state(START)
 {}
 
@@ -79,6 +95,8 @@ PCB::PCB(const PCB &obj)
     this->state = obj.state;
     this->numInstr = obj.numInstr;
     this->numIOInstr = obj.numIOInstr;
+    this->tickets = obj.tickets;
+    this->remCycles = obj.remCycles;
 }
 
 /**
@@ -95,6 +113,8 @@ PCB& PCB::operator=(const PCB &rhs)
     this->state = rhs.state;
     this->numInstr = rhs.numInstr;
     this->numIOInstr = rhs.numIOInstr;
+    this->tickets = rhs.tickets;
+    this->remCycles = rhs.remCycles;
 
     return *this;
 }
@@ -119,6 +139,7 @@ std::ostream & operator << (std::ostream &out, const PCB &pcb)
     out << "State: " << pcb.state << std::endl;
     out << "NumInstr: " << pcb.numInstr << std::endl;
     out << "NumIOInstr: " << pcb.numIOInstr << std::endl;
+    out << "Tickets: " << pcb.tickets << std::endl;
 
     return out;
 }
\ No newline at end of file
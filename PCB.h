@@ -5,6 +5,11 @@
  * 
  * @details Specifies all member methods of the PCB class
  * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add data members tickets and remCycles along with their setters and
+ *          getters for proportional-share scheduling
+ * 
  * @version 1.05
  *          Adam Landis (24 April 2019)
  *          Add overloaded stream insertion operator << method signature.
@@ -85,6 +90,21 @@ public:
      */
     inline void setState(State state) { this->state = state; }
 
+    /**
+     * @brief      Sets the number of scheduling tickets.
+     *
+     * @param[in]  tickets  The number of tickets to set
+     */
+    inline void setTickets(unsigned int tickets) { this->tickets = tickets; }
+
+    /**
+     * @brief      Sets the remaining cycles of a partially executed 
+     *             instruction (0 if the instruction at pc has not started).
+     *
+     * @param[in]  remCycles  The remaining cycles to set
+     */
+    inline void setRemCycles(unsigned long remCycles) { this->remCycles = remCycles; }
+
     /**************************************************************************/
 
     /************************      Getter methods     *************************/
@@ -123,9 +143,24 @@ public:
      */
     inline const State getState() const { return this->state; }
 
+    /**
+     * @brief      Gets the number of scheduling tickets.
+     *
+     * @return     The number of tickets.
+     */
+    inline const unsigned int getTickets() const { return this->tickets; }
+
+    /**
+     * @brief      Gets the remaining cycles of a partially executed instruction.
+     *
+     * @return     The remaining cycles.
+     */
+    inline const unsigned long getRemCycles() const { return this->remCycles; }
+
     /**************************************************************************/
 private:
-    unsigned int pid, pc, numInstr, numIOInstr;
+    unsigned int pid, pc, numInstr, numIOInstr, tickets;
+    unsigned long remCycles;
     State state;
 };
 //
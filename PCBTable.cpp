@@ -0,0 +1,396 @@
+/**
+ * @file PCBTable.cpp
+ * 
+ * @brief Implementation file for PCBTable class
+ * 
+ * @details Implements all member methods of PCBTable class. Next-process 
+ *          selection scans the ready bitmap one 64-process word at a time, 
+ *          skipping empty words, and computes the minimum key of each full 
+ *          word with SIMD compares on the parallel key array.
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          pickFirstReady() starts at the first word that may hold a ready 
+ *          process
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          pickMin() finds the lowest pid from the ready bitmap alone 
+ *          (pickFirstReady())
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Use the scalar search when SIM_SIMD is 0
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Keep context switch counts in add() and clear()
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Maintain per-state process counts in add(), clear() and setState()
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of PCBTable class
+ * 
+ * @note Requries PCBTable.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "PCBTable.h"
+
+#if SIM_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif SIM_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const int32_t KEY_MASKED = 0x7fffffff;      // largest biased key value
+const uint32_t FLIP_MIN = 0x80000000u;      // bias unsigned keys for signed compares
+const uint32_t FLIP_MAX = 0x7fffffffu;      // bias and invert to turn max into min
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Computes the minimum biased key over the ready lanes of one full 
+ *             64-process word.
+ *
+ * @param[in]  keys  Pointer to the 64 keys of the word
+ * @param[in]  bits  The ready bits of the word
+ * @param[in]  flip  The bias applied to each key
+ *
+ * @return     The minimum biased key (KEY_MASKED if none is lower)
+ */
+static int32_t wordMin(const uint32_t *keys, uint64_t bits, uint32_t flip)
+{
+#if SIM_SIMD && defined(__AVX2__)
+    const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i flipv = _mm256_set1_epi32((int) flip);
+    const __m256i maskedv = _mm256_set1_epi32(KEY_MASKED);
+    __m256i vmin = maskedv;
+
+    for (unsigned g = 0; g < 8; g++, bits >>= 8)
+    {
+        if ((bits & 0xff) == 0)
+        {
+            continue;
+        }
+
+        __m256i sel = _mm256_set1_epi32((int)(bits & 0xff));
+        __m256i m = _mm256_cmpeq_epi32(_mm256_and_si256(sel, laneBits), laneBits);
+        __m256i v = _mm256_xor_si256(
+            _mm256_loadu_si256((const __m256i*)(keys + g * 8)), flipv);
+
+        v = _mm256_blendv_epi8(maskedv, v, m);
+        vmin = _mm256_min_epi32(vmin, v);
+    }
+
+    __m128i lo = _mm_min_epi32(_mm256_castsi256_si128(vmin), 
+                               _mm256_extracti128_si256(vmin, 1));
+    lo = _mm_min_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+    lo = _mm_min_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    return _mm_cvtsi128_si32(lo);
+#elif SIM_SIMD && defined(__SSE2__)
+    const __m128i laneBits = _mm_setr_epi32(1, 2, 4, 8);
+    const __m128i flipv = _mm_set1_epi32((int) flip);
+    const __m128i maskedv = _mm_set1_epi32(KEY_MASKED);
+    __m128i vmin = maskedv;
+
+    for (unsigned g = 0; g < 16; g++, bits >>= 4)
+    {
+        if ((bits & 0xf) == 0)
+        {
+            continue;
+        }
+
+        __m128i sel = _mm_set1_epi32((int)(bits & 0xf));
+        __m128i m = _mm_cmpeq_epi32(_mm_and_si128(sel, laneBits), laneBits);
+        __m128i v = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)(keys + g * 4)), flipv);
+        __m128i lt;
+
+        v = _mm_or_si128(_mm_and_si128(m, v), _mm_andnot_si128(m, maskedv));
+        lt = _mm_cmplt_epi32(v, vmin);
+        vmin = _mm_or_si128(_mm_and_si128(lt, v), _mm_andnot_si128(lt, vmin));
+    }
+
+    int32_t lanes[4];
+    int32_t result;
+
+    _mm_storeu_si128((__m128i*) lanes, vmin);
+    result = lanes[0];
+
+    for (unsigned i = 1; i < 4; i++)
+    {
+        if (lanes[i] < result)
+        {
+            result = lanes[i];
+        }
+    }
+
+    return result;
+#else
+    int32_t result = KEY_MASKED;
+
+    for (unsigned i = 0; bits != 0; i++, bits >>= 1)
+    {
+        if ((bits & 1) && (int32_t)(keys[i] ^ flip) < result)
+        {
+            result = (int32_t)(keys[i] ^ flip);
+        }
+    }
+
+    return result;
+#endif
+}
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+PCBTable::PCBTable() : firstReadyWord(0)
+{
+    for (unsigned s = 0; s <= EXIT; s++)
+    {
+        this->stateCount[s] = 0;
+    }
+}
+
+/**
+ * @brief      Appends a PCB to the table.
+ *
+ * @param[in]  pcb   The PCB
+ *
+ * @return     The table index of the new entry
+ */
+unsigned PCBTable::add(const PCB &pcb)
+{
+    unsigned idx = this->pid.size();
+
+    this->pid.push_back(pcb.getPID());
+    this->pc.push_back(pcb.getPC());
+    this->numInstr.push_back(pcb.getNumInstr());
+    this->numIOInstr.push_back(pcb.getNumIOInstr());
+    this->tickets.push_back(pcb.getTickets());
+    this->remCycles.push_back(pcb.getRemCycles());
+    this->volSwitches.push_back(0);
+    this->involSwitches.push_back(0);
+    this->state.push_back((uint8_t) pcb.getState());
+    this->stateCount[pcb.getState()]++;
+
+    if (idx % 64 == 0)
+    {
+        this->readyBits.push_back(0);
+    }
+
+    setState(idx, pcb.getState());
+
+    return idx;
+}
+
+/**
+ * @brief      Removes all entries.
+ */
+void PCBTable::clear()
+{
+    this->pid.clear();
+    this->pc.clear();
+    this->numInstr.clear();
+    this->numIOInstr.clear();
+    this->tickets.clear();
+    this->remCycles.clear();
+    this->volSwitches.clear();
+    this->involSwitches.clear();
+    this->state.clear();
+    this->readyBits.clear();
+    this->firstReadyWord = 0;
+
+    for (unsigned s = 0; s <= EXIT; s++)
+    {
+        this->stateCount[s] = 0;
+    }
+}
+
+/**
+ * @brief      Builds a PCB object from a table entry (e.g. for printing).
+ *
+ * @param[in]  idx   The table index
+ *
+ * @return     The PCB.
+ */
+PCB PCBTable::getPCB(unsigned idx) const
+{
+    PCB pcb(this->pid[idx], this->numInstr[idx], this->numIOInstr[idx]);
+
+    pcb.setPC(this->pc[idx]);
+    pcb.setTickets(this->tickets[idx]);
+    pcb.setRemCycles(this->remCycles[idx]);
+    pcb.setState((State) this->state[idx]);
+
+    return pcb;
+}
+
+/**
+ * @brief      Finds the ready process with the smallest key, breaking ties by 
+ *             lowest table index.
+ *
+ * @param[in]  key   The key to compare
+ * @param      idx   The index of the picked process
+ *
+ * @return     false if no process is ready, true otherwise
+ */
+bool PCBTable::pickMin(PCBKey key, unsigned &idx) const
+{
+    // processes are added in pid order, so the lowest pid is the first ready
+    if (key == KEY_PID)
+    {
+        return pickFirstReady(idx);
+    }
+
+    return pickFirstMin(getKeys(key), FLIP_MIN, idx);
+}
+
+/**
+ * @brief      Finds the ready process with the largest key, breaking ties by 
+ *             lowest table index.
+ *
+ * @param[in]  key   The key to compare
+ * @param      idx   The index of the picked process
+ *
+ * @return     false if no process is ready, true otherwise
+ */
+bool PCBTable::pickMax(PCBKey key, unsigned &idx) const
+{
+    return pickFirstMin(getKeys(key), FLIP_MAX, idx);
+}
+
+/**
+ * @brief      Gets the key array for a given key.
+ *
+ * @param[in]  key   The key
+ *
+ * @return     The key array.
+ */
+const std::vector<uint32_t>& PCBTable::getKeys(PCBKey key) const
+{
+    if (key == KEY_NUM_INSTR)
+    {
+        return this->numInstr;
+    }
+    else if (key == KEY_NUM_IO_INSTR)
+    {
+        return this->numIOInstr;
+    }
+
+    return this->pid;
+}
+
+/**
+ * @brief      Finds the lowest ready index from the first nonzero word of the 
+ *             ready bitmap. The search starts at firstReadyWord and moves it 
+ *             past the empty words it skips, so each word is skipped once 
+ *             until a process before it becomes ready again.
+ *
+ * @param      idx   The index of the picked process
+ *
+ * @return     false if no process is ready, true otherwise
+ */
+bool PCBTable::pickFirstReady(unsigned &idx) const
+{
+    unsigned w = this->firstReadyWord;
+
+    while (w < this->readyBits.size() && this->readyBits[w] == 0)
+    {
+        w++;
+    }
+
+    this->firstReadyWord = w;
+
+    if (w == this->readyBits.size())
+    {
+        return false;
+    }
+
+    idx = w * 64 + __builtin_ctzll(this->readyBits[w]);
+
+    return true;
+}
+
+/**
+ * @brief      Finds the first ready index with the smallest biased key 
+ *             (key ^ flip compared as signed). The first pass finds the word 
+ *             holding the minimum; the second scans only that word.
+ *
+ * @param[in]  keys  The key array
+ * @param[in]  flip  The bias applied to each key
+ * @param      idx   The index of the picked process
+ *
+ * @return     false if no process is ready, true otherwise
+ */
+bool PCBTable::pickFirstMin(const std::vector<uint32_t> &keys, uint32_t flip, 
+                            unsigned &idx) const
+{
+    unsigned numWords = this->readyBits.size();
+    unsigned size = keys.size();
+    int32_t best = KEY_MASKED;
+    unsigned bestWord = numWords;
+
+    for (unsigned w = 0; w < numWords; w++)
+    {
+        uint64_t bits = this->readyBits[w];
+
+        if (bits == 0)
+        {
+            continue;
+        }
+
+        int32_t wmin;
+
+        if (w * 64 + 64 <= size)
+        {
+            wmin = wordMin(&keys[w * 64], bits, flip);
+        }
+        else
+        {
+            wmin = KEY_MASKED;
+
+            for (unsigned i = w * 64; i < size; i++)
+            {
+                if (isReady(i) && (int32_t)(keys[i] ^ flip) < wmin)
+                {
+                    wmin = (int32_t)(keys[i] ^ flip);
+                }
+            }
+        }
+
+        if (bestWord == numWords || wmin < best)
+        {
+            best = wmin;
+            bestWord = w;
+        }
+    }
+
+    if (bestWord == numWords)
+    {
+        return false;
+    }
+
+    for (unsigned i = bestWord * 64; i < size; i++)
+    {
+        if (isReady(i) && (int32_t)(keys[i] ^ flip) == best)
+        {
+            idx = i;
+            return true;
+        }
+    }
+
+    return false;
+}
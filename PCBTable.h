@@ -0,0 +1,285 @@
+/**
+ * @file PCBTable.h
+ * 
+ * @brief Definition file for PCBTable class
+ * 
+ * @details Specifies all member methods of the PCBTable class, which stores 
+ *          the process control blocks of all processes as parallel arrays 
+ *          (structure of arrays) with ready-set membership kept as a bitmap
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Keep the first word of the ready bitmap that may be nonzero 
+ *          (firstReadyWord)
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Add pickFirstReady()
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Add the SIM_SIMD switch
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Count voluntary and involuntary context switches per process 
+ *          (countSwitch(), setSwitches() and their getters)
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Keep a count of processes in each state, returned by 
+ *          getStateCount()
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of PCBTable class
+ * 
+ * @note The next-process search is vectorized with SSE2 (AVX2 when the 
+ *       compiler targets it) and falls back to scalar code otherwise, or 
+ *       when SIM_SIMD is defined as 0.
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef PCB_TABLE_H
+#define PCB_TABLE_H
+
+#ifndef SIM_SIMD
+#define SIM_SIMD 1
+#endif
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <vector>
+#include <algorithm>    // std::min
+#include <stdint.h>     // fixed-width key types
+
+#include "PCB.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum PCBKey {KEY_PID, KEY_NUM_INSTR, KEY_NUM_IO_INSTR};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class PCBTable
+{
+public:
+    PCBTable();
+
+    unsigned add(const PCB &pcb);
+    void clear();
+    PCB getPCB(unsigned idx) const;
+    bool pickMin(PCBKey key, unsigned &idx) const;
+    bool pickMax(PCBKey key, unsigned &idx) const;
+
+    /************************      Setter methods     *************************/
+    /**
+     * @brief      Sets the program counter of a process.
+     *
+     * @param[in]  idx   The table index
+     * @param[in]  pc    The program counter value to set
+     */
+    inline void setPC(unsigned idx, unsigned int pc) { this->pc[idx] = pc; }
+
+    /**
+     * @brief      Sets the remaining cycles of a partially executed 
+     *             instruction.
+     *
+     * @param[in]  idx        The table index
+     * @param[in]  remCycles  The remaining cycles to set
+     */
+    inline void setRemCycles(unsigned idx, unsigned long remCycles) 
+    { 
+        this->remCycles[idx] = remCycles; 
+    }
+
+    /**
+     * @brief      Sets the state of a process, keeping the ready bitmap in 
+     *             sync.
+     *
+     * @param[in]  idx    The table index
+     * @param[in]  state  The state value to set
+     */
+    inline void setState(unsigned idx, State state)
+    {
+        uint64_t bit = (uint64_t) 1 << (idx % 64);
+
+        this->stateCount[this->state[idx]]--;
+        this->stateCount[state]++;
+        this->state[idx] = (uint8_t) state;
+
+        if (state == READY)
+        {
+            this->readyBits[idx / 64] |= bit;
+            this->firstReadyWord = std::min(this->firstReadyWord, idx / 64);
+        }
+        else
+        {
+            this->readyBits[idx / 64] &= ~bit;
+        }
+    }
+
+    /**
+     * @brief      Counts a context switch away from a process.
+     *
+     * @param[in]  idx        The table index
+     * @param[in]  voluntary  True if the process gave up the processor 
+     *                        (waiting for I/O), False if it was preempted
+     */
+    inline void countSwitch(unsigned idx, bool voluntary)
+    {
+        if (voluntary)
+        {
+            this->volSwitches[idx]++;
+        }
+        else
+        {
+            this->involSwitches[idx]++;
+        }
+    }
+
+    /**
+     * @brief      Sets the context switch counts of a process.
+     *
+     * @param[in]  idx        The table index
+     * @param[in]  voluntary  The number of voluntary switches
+     * @param[in]  preempted  The number of involuntary switches
+     */
+    inline void setSwitches(unsigned idx, unsigned voluntary, unsigned preempted)
+    {
+        this->volSwitches[idx] = voluntary;
+        this->involSwitches[idx] = preempted;
+    }
+    /**************************************************************************/
+
+    /************************      Getter methods     *************************/
+    /**
+     * @brief      Gets the number of processes in the table.
+     *
+     * @return     The size.
+     */
+    inline unsigned size() const { return this->pid.size(); }
+
+    /**
+     * @brief      Gets the pid of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The pid.
+     */
+    inline unsigned int getPID(unsigned idx) const { return this->pid[idx]; }
+
+    /**
+     * @brief      Gets the program counter (pc) of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The program counter (pc).
+     */
+    inline unsigned int getPC(unsigned idx) const { return this->pc[idx]; }
+
+    /**
+     * @brief      Gets the number of instructions of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The number of instructions.
+     */
+    inline unsigned int getNumInstr(unsigned idx) const { return this->numInstr[idx]; }
+
+    /**
+     * @brief      Gets the number of IO instructions of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The number of IO instructions.
+     */
+    inline unsigned int getNumIOInstr(unsigned idx) const { return this->numIOInstr[idx]; }
+
+    /**
+     * @brief      Gets the number of scheduling tickets of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The number of tickets.
+     */
+    inline unsigned int getTickets(unsigned idx) const { return this->tickets[idx]; }
+
+    /**
+     * @brief      Gets the remaining cycles of a partially executed 
+     *             instruction.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The remaining cycles.
+     */
+    inline unsigned long getRemCycles(unsigned idx) const { return this->remCycles[idx]; }
+
+    /**
+     * @brief      Gets the state of a process.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The state.
+     */
+    inline State getState(unsigned idx) const { return (State) this->state[idx]; }
+
+    /**
+     * @brief      Gets the number of processes in a state.
+     *
+     * @param[in]  state  The state
+     *
+     * @return     The number of processes.
+     */
+    inline unsigned getStateCount(State state) const { return this->stateCount[state]; }
+
+    /**
+     * @brief      Gets the number of times a process gave up the processor.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The number of voluntary switches.
+     */
+    inline unsigned getVoluntarySwitches(unsigned idx) const { return this->volSwitches[idx]; }
+
+    /**
+     * @brief      Gets the number of times a process was preempted.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     The number of involuntary switches.
+     */
+    inline unsigned getInvoluntarySwitches(unsigned idx) const { return this->involSwitches[idx]; }
+
+    /**
+     * @brief      Determines if a process is in the ready set.
+     *
+     * @param[in]  idx   The table index
+     *
+     * @return     True if ready, False otherwise.
+     */
+    inline bool isReady(unsigned idx) const
+    {
+        return (this->readyBits[idx / 64] >> (idx % 64)) & 1;
+    }
+    /**************************************************************************/
+private:
+    const std::vector<uint32_t>& getKeys(PCBKey key) const;
+    bool pickFirstReady(unsigned &idx) const;
+    bool pickFirstMin(const std::vector<uint32_t> &keys, uint32_t flip, 
+                      unsigned &idx) const;
+
+    std::vector<uint32_t> pid, pc, numInstr, numIOInstr, tickets;
+    std::vector<unsigned long> remCycles;
+    std::vector<uint32_t> volSwitches, involSwitches;
+    std::vector<uint8_t> state;
+    std::vector<uint64_t> readyBits;
+    mutable unsigned firstReadyWord;    // no ready process in the words before
+    unsigned stateCount[EXIT + 1];
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // PCB_TABLE_H
+//
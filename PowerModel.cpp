@@ -0,0 +1,273 @@
+/**
+ * @file PowerModel.cpp
+ * 
+ * @brief Implementation file for PowerModel class
+ * 
+ * @details Implements all member methods of PowerModel class. Time is
+ *          accounted in sample intervals; at the end of each interval the
+ *          governor picks the P-state for the instructions that start after
+ *          it. An instruction already running keeps the P-state it started
+ *          in, since its duration was fixed by that frequency. Busy time
+ *          costs dynamic power, which scales with voltage squared times
+ *          frequency, and every microsecond costs static power, which
+ *          scales with voltage.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of PowerModel class
+ * 
+ * @note Requries PowerModel.h
+ */
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "PowerModel.h"
+
+#include <algorithm>    // std::min
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs a model with no P-states and the performance
+ *             governor.
+ */
+PowerModel::PowerModel() :
+    governor(GOV_PERFORMANCE),
+    sampleUs(DEFAULT_DVFS_SAMPLE_MS * 1000ULL),
+    current(0),
+    lastUs(0),
+    windowStartUs(0),
+    windowBusyUs(0),
+    transitions(0)
+{}
+
+/**
+ * @brief      Adds a P-state, keeping the states ordered by frequency.
+ *
+ * @param[in]  mhz    The frequency in megahertz
+ * @param[in]  volts  The voltage
+ */
+void PowerModel::addState(unsigned mhz, double volts)
+{
+    pState state = {mhz, volts, 0, 0, 0.0};
+    std::vector<pState>::iterator it = this->states.begin();
+
+    while (it != this->states.end() && it->mhz <= mhz)
+    {
+        it++;
+    }
+
+    this->states.insert(it, state);
+}
+
+/**
+ * @brief      Sets the governor and its sample interval, and starts in the
+ *             P-state the governor would pick for a busy processor (the
+ *             slowest for the powersave governor, the fastest otherwise).
+ *             Must be called after the P-states are added.
+ *
+ * @param[in]  governor  The governor
+ * @param[in]  sampleUs  The sample interval in microseconds
+ */
+void PowerModel::setGovernor(DvfsGovernor governor, unsigned long long sampleUs)
+{
+    this->governor = governor;
+    this->sampleUs = sampleUs;
+    this->current = (governor == GOV_POWERSAVE) ? 0 : this->states.size() - 1;
+}
+
+/**
+ * @brief      Accounts the processor as idle up to a time.
+ *
+ * @param[in]  nowUs  The time in microseconds
+ */
+void PowerModel::update(unsigned long long nowUs)
+{
+    if (nowUs > this->lastUs)
+    {
+        advance(nowUs - this->lastUs, false);
+    }
+}
+
+/**
+ * @brief      Accounts the processor as busy for the duration of an
+ *             instruction that started at the time last passed to update().
+ *
+ * @param[in]  us    The duration in microseconds
+ */
+void PowerModel::addBusy(unsigned long long us)
+{
+    advance(us, true);
+}
+
+/**
+ * @brief      Gets how much longer processor cycles take in the current
+ *             P-state than in the fastest one.
+ *
+ * @return     The ratio of the fastest frequency to the current one.
+ */
+double PowerModel::getSlowdown() const
+{
+    return (double) this->states.back().mhz / this->states[this->current].mhz;
+}
+
+/**
+ * @brief      Gets the energy used so far in all P-states.
+ *
+ * @return     The energy in joules.
+ */
+double PowerModel::getEnergy() const
+{
+    double energyJ = 0.0;
+
+    for (const pState &state: this->states)
+    {
+        energyJ += state.energyJ;
+    }
+
+    return energyJ;
+}
+
+/**
+ * @brief      Appends the P-state, the current sample interval and the time
+ *             and energy of every P-state to a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void PowerModel::save(Checkpoint &ckpt) const
+{
+    ckpt.putUInt(this->states.size());
+    ckpt.putUInt(this->current);
+    ckpt.putUInt(this->lastUs);
+    ckpt.putUInt(this->windowStartUs);
+    ckpt.putUInt(this->windowBusyUs);
+    ckpt.putUInt(this->transitions);
+
+    for (const pState &state: this->states)
+    {
+        ckpt.putUInt(state.residencyUs);
+        ckpt.putUInt(state.busyUs);
+        ckpt.putDouble(state.energyJ);
+    }
+}
+
+/**
+ * @brief      Restores the P-state, the current sample interval and the time
+ *             and energy of every P-state from a checkpoint. The P-states
+ *             must be the same as when they were saved; the governor may
+ *             differ.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void PowerModel::restore(Checkpoint &ckpt)
+{
+    if (ckpt.getUInt() != this->states.size())
+    {
+        throw std::string("Error: checkpoint does not match configuration");
+    }
+
+    this->current       = (unsigned) ckpt.getUInt();
+    this->lastUs        = ckpt.getUInt();
+    this->windowStartUs = ckpt.getUInt();
+    this->windowBusyUs  = ckpt.getUInt();
+    this->transitions   = ckpt.getUInt();
+
+    for (pState &state: this->states)
+    {
+        state.residencyUs = ckpt.getUInt();
+        state.busyUs      = ckpt.getUInt();
+        state.energyJ     = ckpt.getDouble();
+    }
+}
+
+/**
+ * @brief      Accounts time, letting the governor decide at the end of every
+ *             sample interval passed.
+ *
+ * @param[in]  us    The time in microseconds
+ * @param[in]  busy  True if the processor executes throughout
+ */
+void PowerModel::advance(unsigned long long us, bool busy)
+{
+    const pState &fastest = this->states.back();
+    unsigned stateIdx = this->current;
+
+    while (us > 0)
+    {
+        unsigned long long part = std::min(us, this->windowStartUs + this->sampleUs - this->lastUs);
+        pState &state = this->states[stateIdx];
+        double ratio = state.volts / fastest.volts;
+        double watts = DVFS_STATIC_WATTS * ratio;
+
+        if (busy)
+        {
+            watts += DVFS_DYNAMIC_WATTS * ratio * ratio * state.mhz / fastest.mhz;
+            state.busyUs += part;
+            this->windowBusyUs += part;
+        }
+
+        state.residencyUs += part;
+        state.energyJ += watts * part / 1000000.0;
+        this->lastUs += part;
+        us -= part;
+
+        if (this->lastUs == this->windowStartUs + this->sampleUs)
+        {
+            decide();
+            this->windowStartUs = this->lastUs;
+            this->windowBusyUs = 0;
+
+            // an idle processor switches at once
+            if (!busy)
+            {
+                stateIdx = this->current;
+            }
+        }
+    }
+}
+
+/**
+ * @brief      Picks the P-state for the next sample interval from the
+ *             utilization of the one that ended:
+ *             - PERFORMANCE and POWERSAVE always pick the fastest and the
+ *               slowest P-state.
+ *             - ONDEMAND jumps to the fastest P-state above 80% utilization,
+ *               and otherwise picks the slowest one that would have kept it
+ *               at 80%.
+ *             - SCHEDUTIL picks the slowest P-state that gives the demand
+ *               measured at the current frequency 25% headroom.
+ */
+void PowerModel::decide()
+{
+    double util = (double) this->windowBusyUs / this->sampleUs;
+    double targetMhz = 0.0;
+    unsigned next = 0;
+
+    switch (this->governor)
+    {
+        case GOV_PERFORMANCE:
+            targetMhz = this->states.back().mhz;
+            break;
+        case GOV_POWERSAVE:
+            break;
+        case GOV_ONDEMAND:
+            targetMhz = (util > ONDEMAND_UP_THRESHOLD) ? this->states.back().mhz :
+                this->states[this->current].mhz * util / ONDEMAND_UP_THRESHOLD;
+            break;
+        default:
+            targetMhz = SCHEDUTIL_HEADROOM * util * this->states[this->current].mhz;
+            break;
+    }
+
+    while (next + 1 < this->states.size() && this->states[next].mhz < targetMhz)
+    {
+        next++;
+    }
+
+    if (next != this->current)
+    {
+        this->current = next;
+        this->transitions++;
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file PowerModel.h
+ * 
+ * @brief Definition file for PowerModel class
+ * 
+ * @details Specifies all member methods of the PowerModel class, which
+ *          models dynamic voltage and frequency scaling of the processor: a
+ *          table of P-states (frequency/voltage pairs), a governor that
+ *          picks the P-state from the processor utilization measured over
+ *          each sample interval, and the energy used in every P-state.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of PowerModel class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef POWER_MODEL_H
+#define POWER_MODEL_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <vector>       // P-states
+
+#include "Checkpoint.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+enum DvfsGovernor {GOV_PERFORMANCE, GOV_POWERSAVE, GOV_ONDEMAND, GOV_SCHEDUTIL,
+                   NUM_GOVERNORS};
+
+const std::string GOVERNOR_NAMES[NUM_GOVERNORS] = {
+    "PERFORMANCE", "POWERSAVE", "ONDEMAND", "SCHEDUTIL"
+};
+
+// used when "Processor P-states" is not set
+const unsigned NUM_DEFAULT_PSTATES = 4;
+const unsigned DEFAULT_PSTATE_MHZ[NUM_DEFAULT_PSTATES] = {800, 1600, 2400, 3200};
+const double DEFAULT_PSTATE_VOLTS[NUM_DEFAULT_PSTATES] = {0.75, 0.90, 1.05, 1.20};
+
+const unsigned DEFAULT_DVFS_SAMPLE_MS = 10;
+const double DVFS_DYNAMIC_WATTS = 20.0;     // busy in the fastest P-state
+const double DVFS_STATIC_WATTS = 4.0;       // leakage at the fastest voltage
+const double ONDEMAND_UP_THRESHOLD = 0.80;  // utilization that jumps to max
+const double SCHEDUTIL_HEADROOM = 1.25;     // frequency margin over demand
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+
+/**
+ * Struct to hold one P-state and the time and energy spent in it.
+ */
+struct pState
+{
+    unsigned mhz;
+    double volts;
+    unsigned long long residencyUs;     // time in the state
+    unsigned long long busyUs;          // time executing in the state
+    double energyJ;
+};
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class PowerModel
+{
+public:
+    PowerModel();
+
+    void addState(unsigned mhz, double volts);
+    void setGovernor(DvfsGovernor governor, unsigned long long sampleUs);
+    void update(unsigned long long nowUs);
+    void addBusy(unsigned long long us);
+    double getSlowdown() const;
+    double getEnergy() const;
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Gets the number of P-states.
+     *
+     * @return     The number of P-states (0 if the model is not used).
+     */
+    inline unsigned getNumStates() const { return this->states.size(); }
+
+    /**
+     * @brief      Gets a P-state.
+     *
+     * @param[in]  state  The P-state, from the slowest
+     *
+     * @return     The P-state.
+     */
+    inline const pState& getState(unsigned state) const { return this->states[state]; }
+
+    /**
+     * @brief      Gets the governor.
+     *
+     * @return     The governor.
+     */
+    inline DvfsGovernor getGovernor() const { return this->governor; }
+
+    /**
+     * @brief      Gets the interval between governor decisions.
+     *
+     * @return     The interval in microseconds.
+     */
+    inline unsigned long long getSampleUs() const { return this->sampleUs; }
+
+    /**
+     * @brief      Gets the number of times the governor changed P-state.
+     *
+     * @return     The number of transitions.
+     */
+    inline unsigned long long getTransitions() const { return this->transitions; }
+private:
+    void advance(unsigned long long us, bool busy);
+    void decide();
+
+    std::vector<pState> states;         // slowest first
+    DvfsGovernor governor;
+    unsigned long long sampleUs;
+    unsigned current;                   // P-state for the next instruction
+    unsigned long long lastUs;          // time accounted up to
+    unsigned long long windowStartUs, windowBusyUs;
+    unsigned long long transitions;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // POWER_MODEL_H
+//
@@ -5,6 +5,14 @@
  * 
  * @details Implements all member methods of Process class
  * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Copy the tenant
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Copy the instruction span instead of an instruction vector
+ * 
  * @version 1.03
  *          Adam Landis (24 April 2019)
  *          Implement overloaded stream insertion operator << method              
@@ -35,12 +43,12 @@
 /**
  * @brief      Constructs the object (default).
  */
-Process::Process() : pid(0) {}
+Process::Process() : pid(0), arena(NULL), offset(0), length(0), tenant(0) {}
 
 /**
  * @brief      Constructs the Process object (parameterized).
  */
-Process::Process(unsigned int pid) : pid(pid) {}
+Process::Process(unsigned int pid) : pid(pid), arena(NULL), offset(0), length(0), tenant(0) {}
 
 /**
  * @brief      Copy constructor
@@ -50,7 +58,10 @@ Process::Process(unsigned int pid) : pid(pid) {}
 Process::Process(const Process &obj)
 {
     this->pid = obj.pid;
-    this->instrVector = obj.instrVector;
+    this->arena = obj.arena;
+    this->offset = obj.offset;
+    this->length = obj.length;
+    this->tenant = obj.tenant;
 }
 
 /**
@@ -63,7 +74,10 @@ Process::Process(const Process &obj)
 Process& Process::operator=(const Process &rhs)
 {
     this->pid = rhs.pid;
-    this->instrVector = rhs.instrVector;
+    this->arena = rhs.arena;
+    this->offset = rhs.offset;
+    this->length = rhs.length;
+    this->tenant = rhs.tenant;
 
     return *this;
 }
@@ -86,9 +100,9 @@ std::ostream & operator << (std::ostream &out, const Process &process)
     out << "PID: " << process.pid << std::endl;
     out << "Instructions:\n";
 
-    for (unsigned i = 0; i < process.instrVector.size(); i++)
+    for (unsigned i = 0; i < process.length; i++)
     {
-        out << "\t" << process.instrVector[i].toString() << std::endl;
+        out << "\t" << process.getInstr(i).toString() << std::endl;
     }
 
     return out;
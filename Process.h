@@ -5,6 +5,17 @@
  * 
  * @details Specifies all member methods of the Process class
  * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add the tenant the process belongs to, with setTenant() and 
+ *          getTenant()
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Replace the per-process instruction vector with an offset/length 
+ *          span into the shared instruction arena; getInstr() returns by const
+ *          reference and getNumInstr() replaces getInstrVector()
+ * 
  * @version 1.04
  *          Adam Landis (24 April 2019)
  *          Add overloaded stream insertion operator << method signature.
@@ -60,14 +71,27 @@ public:
 
     /************************      Setter methods     *************************/
     /**
-     * @brief      Sets the instr vector.
+     * @brief      Sets the span of the shared instruction arena holding this 
+     *             process's instructions.
      *
-     * @param[in]  instrVector  The instr vector to copy
+     * @param[in]  arena   The instruction arena
+     * @param[in]  offset  The index of the first instruction
+     * @param[in]  length  The number of instructions
      */
-    inline void setInstrVector(std::vector<MetadataInstruction> instrVector)
+    inline void setInstrSpan(const std::vector<MetadataInstruction> *arena, 
+                             unsigned offset, unsigned length)
     {
-        this->instrVector = instrVector;
+        this->arena = arena;
+        this->offset = offset;
+        this->length = length;
     }
+
+    /**
+     * @brief      Sets the tenant the process belongs to.
+     *
+     * @param[in]  tenant  The tenant index (0 for the "File Path" metadata)
+     */
+    inline void setTenant(unsigned tenant) { this->tenant = tenant; }
     /**************************************************************************/
 
     /************************      Getter methods     *************************/
@@ -79,31 +103,44 @@ public:
     inline const unsigned int getPID() const { return this->pid; }
 
     /**
-     * @brief      Gets the instruction vector.
+     * @brief      Gets the number of instructions.
      *
-     * @return     The instruction vector.
+     * @return     The number of instructions.
      */
-    inline const std::vector<MetadataInstruction> getInstrVector() const
-    {
-        return this->instrVector;
-    }
+    inline unsigned getNumInstr() const { return this->length; }
+
+    /**
+     * @brief      Gets the arena offset of the first instruction.
+     *
+     * @return     The offset.
+     */
+    inline unsigned getOffset() const { return this->offset; }
+
+    /**
+     * @brief      Gets the tenant the process belongs to.
+     *
+     * @return     The tenant index.
+     */
+    inline unsigned getTenant() const { return this->tenant; }
 
     /**
-     * @brief      Gets the instruciton from instrVector located at index idx.
+     * @brief      Gets the instruction located at index idx of the process.
      *
      * @param[in]  idx   The index
      *
      * @return     The instr.
      */
-    inline const MetadataInstruction getInstr(unsigned idx) const
+    inline const MetadataInstruction& getInstr(unsigned idx) const
     { 
-        return this->instrVector[idx];
+        return (*this->arena)[this->offset + idx];
     }
     /**************************************************************************/
 
 private:
     unsigned int pid;
-    std::vector<MetadataInstruction> instrVector;
+    const std::vector<MetadataInstruction> *arena;
+    unsigned offset, length;
+    unsigned tenant;
 };
 //
 // Terminating Precompiler Directives
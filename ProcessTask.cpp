@@ -0,0 +1,99 @@
+/**
+ * @file ProcessTask.cpp
+ * 
+ * @brief Implementation file for ProcessTask class
+ * 
+ * @details Implements all member methods of ProcessTask class
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of ProcessTask class
+ * 
+ * @note Requries ProcessTask.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "ProcessTask.h"
+
+#if SIM_COROUTINES
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs an empty task.
+ */
+ProcessTask::ProcessTask() : handle(nullptr) {}
+
+/**
+ * @brief      Constructs a task owning a coroutine.
+ *
+ * @param[in]  handle  The coroutine handle
+ */
+ProcessTask::ProcessTask(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+/**
+ * @brief      Move constructor.
+ *
+ * @param      obj   The task to take the coroutine from
+ */
+ProcessTask::ProcessTask(ProcessTask &&obj) noexcept : handle(obj.handle)
+{
+    obj.handle = nullptr;
+}
+
+/**
+ * @brief      Move assignment operator, destroying any coroutine held.
+ *
+ * @param      rhs   The task to take the coroutine from
+ *
+ * @return     This task.
+ */
+ProcessTask& ProcessTask::operator=(ProcessTask &&rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        if (this->handle)
+        {
+            this->handle.destroy();
+        }
+
+        this->handle = rhs.handle;
+        rhs.handle = nullptr;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief      Destroys the task and its coroutine frame.
+ */
+ProcessTask::~ProcessTask()
+{
+    if (this->handle)
+    {
+        this->handle.destroy();
+    }
+}
+
+/**
+ * @brief      Runs the coroutine until it next suspends or finishes, 
+ *             rethrowing any exception it raised.
+ */
+void ProcessTask::resume()
+{
+    if (!this->handle || this->handle.done())
+    {
+        return;
+    }
+
+    this->handle.resume();
+
+    if (this->handle.promise().exception)
+    {
+        std::rethrow_exception(this->handle.promise().exception);
+    }
+}
+
+#endif  // SIM_COROUTINES
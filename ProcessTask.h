@@ -0,0 +1,88 @@
+/**
+ * @file ProcessTask.h
+ * 
+ * @brief Definition file for ProcessTask class
+ * 
+ * @details Specifies all member methods of the ProcessTask class, the handle 
+ *          of a simulated process running as a stackless C++20 coroutine. 
+ *          The coroutine starts suspended and runs only while resumed by the
+ *          simulation's dispatcher; it suspends itself while its process 
+ *          waits for I/O, so a blocked process costs one coroutine frame 
+ *          instead of an OS thread.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of ProcessTask class
+ * 
+ * @note Only built with -DSIM_COROUTINES=1 and C++20 ("make coro").
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef PROCESS_TASK_H
+#define PROCESS_TASK_H
+
+#ifndef SIM_COROUTINES
+#define SIM_COROUTINES 0
+#endif
+
+#if SIM_COROUTINES
+#if __cplusplus < 202002L
+#error "SIM_COROUTINES requires C++20 (build with make coro)"
+#endif
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <coroutine>
+#include <exception>    // exception_ptr
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class ProcessTask
+{
+public:
+    /**
+     * Coroutine promise: starts suspended, stays suspended when finished so 
+     * the task can tell, and keeps any exception for resume() to rethrow
+     */
+    struct promise_type
+    {
+        std::exception_ptr exception;
+
+        ProcessTask get_return_object()
+        {
+            return ProcessTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { this->exception = std::current_exception(); }
+    };
+
+    ProcessTask();
+    explicit ProcessTask(std::coroutine_handle<promise_type> handle);
+    ProcessTask(ProcessTask &&obj) noexcept;
+    ProcessTask& operator=(ProcessTask &&rhs) noexcept;
+    ProcessTask(const ProcessTask &) = delete;
+    ProcessTask& operator=(const ProcessTask &) = delete;
+    ~ProcessTask();
+
+    void resume();
+
+    /**
+     * @brief      Determines if the task holds a coroutine.
+     *
+     * @return     True if a coroutine was started, False otherwise.
+     */
+    inline bool isValid() const { return (bool) this->handle; }
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif  // SIM_COROUTINES
+//
+// Terminating Precompiler Directives
+// 
+#endif  // PROCESS_TASK_H
+//
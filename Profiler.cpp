@@ -0,0 +1,201 @@
+/**
+ * @file Profiler.cpp
+ * 
+ * @brief Implementation file for Profiler class
+ * 
+ * @details Implements all member methods of Profiler class, and replaces the 
+ *          global operator new/delete to count heap allocations per thread
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Replace operator new/delete only if SIM_PROFILE is set
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Profiler class
+ * 
+ * @note Requries Profiler.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "Profiler.h"
+
+#include <cstdlib>      // malloc, free
+#include <new>          // bad_alloc
+#include <sstream>      // ostringstream
+#include <iomanip>      // setw, setprecision
+//
+// Global Variable Definitions /////////////////////////////////////////////////
+//
+static thread_local unsigned long long threadAllocs = 0;
+static std::atomic<unsigned long long> totalAllocs(0);
+
+std::atomic<bool> Profiler::enabled(false);
+std::atomic<unsigned long long> Profiler::calls[NUM_PHASES];
+std::atomic<unsigned long long> Profiler::nanos[NUM_PHASES];
+std::atomic<unsigned long long> Profiler::allocs[NUM_PHASES];
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Enables profiling, clearing all counters.
+ */
+void Profiler::enable()
+{
+    for (unsigned p = 0; p < NUM_PHASES; p++)
+    {
+        calls[p] = 0;
+        nanos[p] = 0;
+        allocs[p] = 0;
+    }
+
+    totalAllocs = 0;
+    enabled = true;
+}
+
+/**
+ * @brief      Charges one call of a phase.
+ *
+ * @param[in]  phase   The phase
+ * @param[in]  nanos   The wall time of the call in nanoseconds
+ * @param[in]  allocs  The heap allocations made during the call
+ */
+void Profiler::add(ProfilePhase phase, unsigned long long nanos, 
+                   unsigned long long allocs)
+{
+    Profiler::calls[phase].fetch_add(1, std::memory_order_relaxed);
+    Profiler::nanos[phase].fetch_add(nanos, std::memory_order_relaxed);
+    Profiler::allocs[phase].fetch_add(allocs, std::memory_order_relaxed);
+}
+
+/**
+ * @brief      Gets the number of heap allocations made by the calling thread.
+ *
+ * @return     The number of allocations.
+ */
+unsigned long long Profiler::getThreadAllocs()
+{
+    return threadAllocs;
+}
+
+/**
+ * @brief      Gets the number of heap allocations made by all threads since 
+ *             profiling was enabled.
+ *
+ * @return     The number of allocations.
+ */
+unsigned long long Profiler::getTotalAllocs()
+{
+    return totalAllocs;
+}
+
+/**
+ * @brief      Generates the per-phase profile report.
+ *
+ * @param[in]  wallTime  The total wall time of the run in milliseconds
+ *
+ * @return     The report.
+ */
+std::string Profiler::genReport(double wallTime)
+{
+    std::ostringstream out;
+
+    out << std::fixed << std::setprecision(3);
+    out << "Profile (wall time " << wallTime << " ms, " 
+        << getTotalAllocs() << " allocations)\n";
+    out << std::left << std::setw(18) << "Phase" << std::right 
+        << std::setw(12) << "Calls" 
+        << std::setw(14) << "Time (ms)" 
+        << std::setw(8) << "%"
+        << std::setw(12) << "Mean (us)" 
+        << std::setw(12) << "Allocs" << "\n";
+
+    for (unsigned p = 0; p < NUM_PHASES; p++)
+    {
+        double ms = nanos[p] / 1000000.0;
+
+        out << std::left << std::setw(18) << PROFILE_PHASE_NAMES[p] << std::right
+            << std::setw(12) << calls[p]
+            << std::setw(14) << ms 
+            << std::setw(8) << std::setprecision(1) 
+            << (wallTime > 0 ? 100.0 * ms / wallTime : 0.0) << std::setprecision(3)
+            << std::setw(12) << (calls[p] ? nanos[p] / 1000.0 / calls[p] : 0.0)
+            << std::setw(12) << allocs[p] << "\n";
+    }
+
+    out << "\n";
+
+    return out.str();
+}
+
+/**
+ * @brief      Generates the per-phase profile as a JSON object.
+ *
+ * @param[in]  wallTime  The total wall time of the run in milliseconds
+ *
+ * @return     The JSON text.
+ */
+std::string Profiler::genJSON(double wallTime)
+{
+    std::ostringstream out;
+
+    out << "{\"wall_ms\": " << wallTime 
+        << ", \"allocs\": " << getTotalAllocs() 
+        << ", \"phases\": {";
+
+    for (unsigned p = 0; p < NUM_PHASES; p++)
+    {
+        out << (p ? ", " : "") << "\"" << PROFILE_PHASE_NAMES[p] << "\": "
+            << "{\"calls\": " << calls[p] 
+            << ", \"ms\": " << nanos[p] / 1000000.0
+            << ", \"allocs\": " << allocs[p] << "}";
+    }
+
+    out << "}}\n";
+
+    return out.str();
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+#if SIM_PROFILE
+
+/**
+ * @brief      Allocates memory, counting the allocation.
+ *
+ * @param[in]  size  The number of bytes
+ *
+ * @return     Pointer to the allocated memory.
+ */
+void* operator new(size_t size)
+{
+    void *ptr = malloc(size == 0 ? 1 : size);
+
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    threadAllocs++;
+
+    if (Profiler::isEnabled())
+    {
+        totalAllocs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return ptr;
+}
+
+/**
+ * @brief      Frees memory allocated by operator new.
+ *
+ * @param      ptr   Pointer to the memory
+ */
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+#endif  // SIM_PROFILE
@@ -0,0 +1,134 @@
+/**
+ * @file Profiler.h
+ * 
+ * @brief Definition file for Profiler class
+ * 
+ * @details Specifies all member methods of the Profiler class, which 
+ *          accumulates wall time, call counts and heap allocations per 
+ *          simulator phase, and of the ProfileScope class, a scoped timer 
+ *          that charges its lifetime to a phase. Phase times are inclusive: 
+ *          logging and I/O thread time is also counted in execution.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Initialize all ProfileScope members, also when profiling is off
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Profiler class
+ * 
+ * @note Profiling costs one relaxed atomic load per scope until enabled with 
+ *       Profiler::enable(). Build with -DSIM_PROFILE=0 to compile the scopes 
+ *       out entirely.
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifndef SIM_PROFILE
+#define SIM_PROFILE 1
+#endif
+
+#if SIM_PROFILE
+#define PROFILE_SCOPE(phase) ProfileScope profileScope_(phase)
+#else
+#define PROFILE_SCOPE(phase)
+#endif
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <atomic>       // counters shared between threads
+#include <chrono>       // steady_clock
+//
+// Enums ///////////////////////////////////////////////////////////////////////
+//
+enum ProfilePhase {PHASE_CONFIG, PHASE_PARSE, PHASE_CREATE_PROCESSES, 
+                   PHASE_SCHEDULE, PHASE_EXECUTE, PHASE_LOG, PHASE_IO_THREAD,
+                   PHASE_CHECKPOINT, NUM_PHASES};
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const std::string PROFILE_PHASE_NAMES[NUM_PHASES] = {
+    "config", "parse", "createProcesses", "schedule", 
+    "execute", "log", "ioThread", "checkpoint"
+};
+//
+// Class Definitions ///////////////////////////////////////////////////////////
+// 
+class Profiler
+{
+public:
+    static void enable();
+    static void add(ProfilePhase phase, unsigned long long nanos, 
+                    unsigned long long allocs);
+    static unsigned long long getThreadAllocs();
+    static unsigned long long getTotalAllocs();
+    static std::string genReport(double wallTime);
+    static std::string genJSON(double wallTime);
+
+    /**
+     * @brief      Determines if profiling is enabled.
+     *
+     * @return     True if enabled, False otherwise.
+     */
+    static inline bool isEnabled() 
+    { 
+        return enabled.load(std::memory_order_relaxed); 
+    }
+private:
+    static std::atomic<bool> enabled;
+    static std::atomic<unsigned long long> calls[NUM_PHASES];
+    static std::atomic<unsigned long long> nanos[NUM_PHASES];
+    static std::atomic<unsigned long long> allocs[NUM_PHASES];
+};
+
+class ProfileScope
+{
+public:
+    /**
+     * @brief      Starts timing a phase if profiling is enabled.
+     *
+     * @param[in]  phase  The phase
+     */
+    inline explicit ProfileScope(ProfilePhase phase) : 
+        phase(phase), 
+        active(Profiler::isEnabled()),
+        allocs(0),
+        start()
+    {
+        if (this->active)
+        {
+            this->allocs = Profiler::getThreadAllocs();
+            this->start = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * @brief      Charges the elapsed time and allocations to the phase.
+     */
+    inline ~ProfileScope()
+    {
+        if (this->active)
+        {
+            std::chrono::steady_clock::duration elapsed = 
+                std::chrono::steady_clock::now() - this->start;
+
+            Profiler::add(this->phase, 
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                Profiler::getThreadAllocs() - this->allocs);
+        }
+    }
+private:
+    ProfilePhase phase;
+    bool active;
+    unsigned long long allocs;
+    std::chrono::steady_clock::time_point start;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // PROFILER_H
+//
@@ -0,0 +1,271 @@
+/**
+ * @file ShareScheduler.cpp
+ * 
+ * @brief Implementation file for ShareScheduler class
+ * 
+ * @details Implements all member methods of ShareScheduler class. Stride 
+ *          scheduling keeps runnable processes in a min-heap keyed by pass 
+ *          value; lottery scheduling keeps runnable tickets in a Fenwick tree 
+ *          so that both picking and requeueing are O(log n).
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Profile pickNext() and requeue()
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add save() and restore() for checkpoints
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of ShareScheduler class
+ * 
+ * @note Requries ShareScheduler.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "ShareScheduler.h"
+#include "Profiler.h"
+
+#include <sstream>      // ostringstream, istringstream
+#include <string>
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ *
+ * @param[in]  isLottery  True for lottery scheduling, false for stride
+ * @param[in]  seed       The seed for lottery draws
+ */
+ShareScheduler::ShareScheduler(bool isLottery, unsigned long seed) : 
+    isLottery(isLottery), 
+    totalTickets(0), 
+    runnableTickets(0), 
+    rng(seed)
+{}
+
+/**
+ * @brief      Adds a runnable process with the given number of tickets. 
+ *             Processes must be added with consecutive indices starting at 0.
+ *
+ * @param[in]  idx      The process index
+ * @param[in]  tickets  The number of tickets (0 selects DEFAULT_TICKETS)
+ */
+void ShareScheduler::addProcess(unsigned idx, unsigned tickets)
+{
+    if (tickets == 0)
+    {
+        tickets = DEFAULT_TICKETS;
+    }
+
+    this->tickets.push_back(tickets);
+    this->stride.push_back(STRIDE1 / tickets);
+    this->pass.push_back(STRIDE1 / tickets);
+    this->totalTickets += tickets;
+
+    if (this->isLottery)
+    {
+        // a new Fenwick node covers its own tickets plus its complete children
+        unsigned long long node = tickets;
+        unsigned i = idx + 1;
+
+        for (unsigned j = i - 1; j > i - (i & (~i + 1)); j -= j & (~j + 1))
+        {
+            node += this->ticketTree[j - 1];
+        }
+
+        this->ticketTree.push_back(node);
+        this->runnableTickets += tickets;
+    }
+    else
+    {
+        this->passQueue.push(passEntry(this->pass[idx], idx));
+    }
+}
+
+/**
+ * @brief      Picks the next process to run and removes it from the runnable 
+ *             set until it is requeued.
+ *
+ * @param      idx   The index of the picked process
+ *
+ * @return     false if no process is runnable, true otherwise
+ */
+bool ShareScheduler::pickNext(unsigned &idx)
+{
+    PROFILE_SCOPE(PHASE_SCHEDULE);
+
+    if (this->isLottery)
+    {
+        if (this->runnableTickets == 0)
+        {
+            return false;
+        }
+
+        std::uniform_int_distribution<unsigned long long> distr(0, this->runnableTickets - 1);
+
+        idx = treeFind(distr(this->rng));
+        treeAdd(idx, -(long long) this->tickets[idx]);
+        this->runnableTickets -= this->tickets[idx];
+    }
+    else
+    {
+        if (this->passQueue.empty())
+        {
+            return false;
+        }
+
+        idx = this->passQueue.top().second;
+        this->passQueue.pop();
+    }
+
+    return true;
+}
+
+/**
+ * @brief      Returns a picked process to the runnable set after it consumed 
+ *             the given number of processor cycles.
+ *
+ * @param[in]  idx         The process index
+ * @param[in]  cyclesUsed  The processor cycles used during its last quantum
+ */
+void ShareScheduler::requeue(unsigned idx, unsigned long cyclesUsed)
+{
+    PROFILE_SCOPE(PHASE_SCHEDULE);
+
+    if (this->isLottery)
+    {
+        treeAdd(idx, this->tickets[idx]);
+        this->runnableTickets += this->tickets[idx];
+    }
+    else
+    {
+        this->pass[idx] += this->stride[idx] * cyclesUsed;
+        this->passQueue.push(passEntry(this->pass[idx], idx));
+    }
+}
+
+/**
+ * @brief      Appends the scheduling state (pass values, runnable set and 
+ *             lottery generator) to a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void ShareScheduler::save(Checkpoint &ckpt) const
+{
+    std::priority_queue<passEntry, std::vector<passEntry>, std::greater<passEntry> > queue = this->passQueue;
+    std::ostringstream rngState;
+
+    ckpt.putUInt(this->pass.size());
+
+    for (unsigned long long value: this->pass)
+    {
+        ckpt.putUInt(value);
+    }
+
+    for (unsigned long long node: this->ticketTree)
+    {
+        ckpt.putUInt(node);
+    }
+
+    ckpt.putUInt(this->runnableTickets);
+    ckpt.putUInt(queue.size());
+
+    while (!queue.empty())
+    {
+        ckpt.putUInt(queue.top().first);
+        ckpt.putUInt(queue.top().second);
+        queue.pop();
+    }
+
+    rngState << this->rng;
+    ckpt.putString(rngState.str());
+}
+
+/**
+ * @brief      Restores the scheduling state from a checkpoint. The same 
+ *             processes must have been added as when it was saved.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void ShareScheduler::restore(Checkpoint &ckpt)
+{
+    unsigned long long queueSize;
+    std::istringstream rngState;
+
+    if (ckpt.getUInt() != this->pass.size())
+    {
+        throw std::string("Error: checkpoint does not match metadata");
+    }
+
+    for (unsigned long long &value: this->pass)
+    {
+        value = ckpt.getUInt();
+    }
+
+    for (unsigned long long &node: this->ticketTree)
+    {
+        node = ckpt.getUInt();
+    }
+
+    this->runnableTickets = ckpt.getUInt();
+    this->passQueue = std::priority_queue<passEntry, std::vector<passEntry>, std::greater<passEntry> >();
+    queueSize = ckpt.getUInt();
+
+    for (unsigned long long k = 0; k < queueSize; k++)
+    {
+        unsigned long long passValue = ckpt.getUInt();
+
+        this->passQueue.push(passEntry(passValue, (unsigned) ckpt.getUInt()));
+    }
+
+    rngState.str(ckpt.getString());
+    rngState >> this->rng;
+}
+
+/**
+ * @brief      Adds delta tickets at the given index of the Fenwick tree.
+ *
+ * @param[in]  idx    The process index
+ * @param[in]  delta  The change in tickets
+ */
+void ShareScheduler::treeAdd(unsigned idx, long long delta)
+{
+    for (unsigned i = idx + 1; i <= this->ticketTree.size(); i += i & (~i + 1))
+    {
+        this->ticketTree[i - 1] += delta;
+    }
+}
+
+/**
+ * @brief      Finds the process holding the winning ticket.
+ *
+ * @param[in]  target  The winning ticket number (0-based)
+ *
+ * @return     The index of the process holding the ticket
+ */
+unsigned ShareScheduler::treeFind(unsigned long long target) const
+{
+    unsigned pos = 0;
+    unsigned size = this->ticketTree.size();
+    unsigned step = 1;
+
+    while (step * 2 <= size)
+    {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2)
+    {
+        if (pos + step <= size && this->ticketTree[pos + step - 1] <= target)
+        {
+            pos += step;
+            target -= this->ticketTree[pos - 1];
+        }
+    }
+
+    return pos;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ShareScheduler.h
+ * 
+ * @brief Definition file for ShareScheduler class
+ * 
+ * @details Specifies all member methods of the ShareScheduler class, which 
+ *          selects processes for proportional-share (stride and lottery) CPU 
+ *          scheduling based on per-process ticket counts
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Add global constant MAX_TICKETS
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add save() and restore() for checkpoints
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of ShareScheduler class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef SHARE_SCHEDULER_H
+#define SHARE_SCHEDULER_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <vector>       // for ticket, stride and pass tables
+#include <queue>        // for the stride priority queue
+#include <random>       // for lottery draws
+#include <utility>      // std::pair
+#include <functional>   // std::greater
+
+#include "Checkpoint.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const unsigned DEFAULT_TICKETS = 100;
+const unsigned long long STRIDE1 = 1ULL << 20;
+const unsigned MAX_TICKETS = (unsigned) STRIDE1;    // keeps every stride >= 1
+//
+// Typedefs ////////////////////////////////////////////////////////////////////
+//
+typedef std::pair<unsigned long long, unsigned> passEntry;
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class ShareScheduler
+{
+public:
+    ShareScheduler(bool isLottery, unsigned long seed);
+
+    void addProcess(unsigned idx, unsigned tickets);
+    bool pickNext(unsigned &idx);
+    void requeue(unsigned idx, unsigned long cyclesUsed);
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Gets the ticket count assigned to a process.
+     *
+     * @param[in]  idx   The process index
+     *
+     * @return     The number of tickets.
+     */
+    inline unsigned getTickets(unsigned idx) const { return this->tickets[idx]; }
+
+    /**
+     * @brief      Gets the total number of tickets of all added processes.
+     *
+     * @return     The total number of tickets.
+     */
+    inline unsigned long long getTotalTickets() const { return this->totalTickets; }
+private:
+    void treeAdd(unsigned idx, long long delta);
+    unsigned treeFind(unsigned long long target) const;
+
+    bool isLottery;
+    std::vector<unsigned> tickets;
+    std::vector<unsigned long long> stride;
+    std::vector<unsigned long long> pass;
+    std::priority_queue<passEntry, std::vector<passEntry>, std::greater<passEntry> > passQueue;
+    std::vector<unsigned long long> ticketTree;     // Fenwick tree of tickets
+    unsigned long long totalTickets;
+    unsigned long long runnableTickets;
+    std::mt19937_64 rng;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // SHARE_SCHEDULER_H
+//
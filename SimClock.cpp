@@ -0,0 +1,107 @@
+/**
+ * @file SimClock.cpp
+ * 
+ * @brief Implementation file for SimClock class
+ * 
+ * @details Implements all member methods of SimClock class
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Add advanceTo() for I/O completions
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          start() takes the time to start from, for resumed runs
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of SimClock class
+ * 
+ * @note Requries SimClock.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "SimClock.h"
+
+#include <cmath>        // llround
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+SimClock::SimClock() : virtualMode(false), startUs(0), virtualUs(0) {}
+
+/**
+ * @brief      Starts the clock.
+ *
+ * @param[in]  isVirtual  True for virtual time, False for real time
+ * @param[in]  startUs    The time to start from in microseconds (non-zero when
+ *                        resuming from a checkpoint)
+ */
+void SimClock::start(bool isVirtual, unsigned long long startUs)
+{
+    this->virtualMode = isVirtual;
+    this->startUs = startUs;
+    this->virtualUs = startUs;
+    this->timer.startTimer();
+}
+
+/**
+ * @brief      Lets a specified amount of time pass: busy-waits in real-time 
+ *             mode, advances the virtual clock otherwise.
+ *
+ * @param[in]  duration  The duration in milliseconds
+ */
+void SimClock::advance(float duration)
+{
+    if (this->virtualMode)
+    {
+        this->virtualUs += (unsigned long long) llround(duration * 1000.0);
+    }
+    else
+    {
+        Timer waitTimer;
+
+        waitTimer.startTimer();
+        while (waitTimer.getDuration() < duration);
+    }
+}
+
+/**
+ * @brief      Lets time pass until a given simulation time: busy-waits in 
+ *             real-time mode, moves the virtual clock forward otherwise. Does 
+ *             nothing if the time has already passed.
+ *
+ * @param[in]  us    The simulation time in microseconds
+ */
+void SimClock::advanceTo(unsigned long long us)
+{
+    if (this->virtualMode)
+    {
+        unsigned long long now = this->virtualUs;
+
+        while (now < us && !this->virtualUs.compare_exchange_weak(now, us));
+    }
+    else
+    {
+        while (getMicroseconds() < us);
+    }
+}
+
+/**
+ * @brief      Gets the current simulation time in microseconds.
+ *
+ * @return     The time since start in microseconds.
+ */
+unsigned long long SimClock::getMicroseconds()
+{
+    if (this->virtualMode)
+    {
+        return this->virtualUs;
+    }
+
+    return this->startUs + this->timer.getMicroseconds();
+}
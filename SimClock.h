@@ -0,0 +1,65 @@
+/**
+ * @file SimClock.h
+ * 
+ * @brief Definition file for SimClock class
+ * 
+ * @details Specifies all member methods of the SimClock class, the simulation
+ *          clock. In real-time mode operations busy-wait on a Timer; in 
+ *          virtual-time mode they advance a virtual clock instantly, which 
+ *          makes runs fast and their timelines deterministic.
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Add advanceTo() for I/O completions
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          start() takes the time to start from, for resumed runs
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of SimClock class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <atomic>       // virtual clock shared with I/O threads
+
+#include "Timer.h"
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class SimClock
+{
+public:
+    SimClock();
+
+    void start(bool isVirtual, unsigned long long startUs);
+    void advance(float duration);
+    void advanceTo(unsigned long long us);
+    unsigned long long getMicroseconds();
+
+    /**
+     * @brief      Determines if the clock runs in virtual time.
+     *
+     * @return     True if virtual, False if real time.
+     */
+    inline bool isVirtual() const { return this->virtualMode; }
+private:
+    Timer timer;
+    bool virtualMode;
+    unsigned long long startUs;
+    std::atomic<unsigned long long> virtualUs;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // SIM_CLOCK_H
+//
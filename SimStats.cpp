@@ -0,0 +1,444 @@
+/**
+ * @file SimStats.cpp
+ * 
+ * @brief Implementation file for SimStats class
+ * 
+ * @details Implements all member methods of SimStats class
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          genSummary() reports the simulated time on its own line
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Record the threads, work and span of each process's fork/join 
+ *          regions
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Accumulate the processor time of each process
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Count dispatches and context switches and the time they cost
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Count I/O completion interrupts and their handling time
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          restore() accepts a different number of device units, for what-if 
+ *          variants
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add save() and restore() for checkpoints
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of SimStats class
+ * 
+ * @note Requries SimStats.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "SimStats.h"
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object.
+ */
+SimStats::SimStats()
+{
+    reset(0, 0, 0);
+}
+
+/**
+ * @brief      Clears all counters and sizes the per-process and per-unit 
+ *             arrays.
+ *
+ * @param[in]  numProcesses  The number of processes
+ * @param[in]  numHD         The number of hard drives
+ * @param[in]  numProj       The number of projectors
+ */
+void SimStats::reset(unsigned numProcesses, unsigned numHD, unsigned numProj)
+{
+    this->totalInstr = 0;
+    this->interrupts = 0;
+    this->interruptUs = 0;
+    this->dispatches = 0;
+    this->switches = 0;
+    this->dispatchUs = 0;
+    this->switchUs = 0;
+    this->refillUs = 0;
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        this->devOps[d] = 0;
+        this->devCycles[d] = 0;
+        this->devTime[d] = 0.0;
+    }
+
+    for (unsigned c = 0; c < 4; c++)
+    {
+        for (unsigned d = 0; d < NUM_DESCRIPTORS; d++)
+        {
+            this->typeCount[c][d] = 0;
+            this->typeCycles[c][d] = 0;
+        }
+    }
+
+    this->hdUnitOps.assign(numHD, 0);
+    this->projUnitOps.assign(numProj, 0);
+    this->procInstr.assign(numProcesses, 0);
+    this->procCycles.assign(numProcesses, 0);
+    this->procTime.assign(numProcesses, 0.0);
+    this->procCpuTime.assign(numProcesses, 0.0);
+    this->procRegions.assign(numProcesses, 0);
+    this->procThreads.assign(numProcesses, 0);
+    this->procWorkUs.assign(numProcesses, 0);
+    this->procSpanUs.assign(numProcesses, 0);
+}
+
+/**
+ * @brief      Records one executed instruction (or processor slice).
+ *
+ * @param[in]  procIdx   The process index (pid - 1)
+ * @param[in]  instr     The instruction
+ * @param[in]  cycles    The cycles executed
+ * @param[in]  waitTime  The time taken (ms)
+ * @param[in]  unit      The device unit (hard drive and projector only)
+ */
+void SimStats::record(unsigned procIdx, const MetadataInstruction &instr, 
+                      unsigned long cycles, double waitTime, unsigned unit)
+{
+    Device device = instr.getDevice();
+    size_t codeIdx = STATS_CODES.find(instr.getCode());
+
+    this->totalInstr++;
+
+    if (device != DEV_NONE)
+    {
+        this->devOps[device]++;
+        this->devCycles[device] += cycles;
+        this->devTime[device] += waitTime;
+    }
+
+    if (device == DEV_HARD_DRIVE && unit < this->hdUnitOps.size())
+    {
+        this->hdUnitOps[unit]++;
+    }
+    else if (device == DEV_PROJECTOR && unit < this->projUnitOps.size())
+    {
+        this->projUnitOps[unit]++;
+    }
+
+    if (codeIdx != std::string::npos && instr.getDescId() < NUM_DESCRIPTORS)
+    {
+        this->typeCount[codeIdx][instr.getDescId()]++;
+        this->typeCycles[codeIdx][instr.getDescId()] += cycles;
+    }
+
+    if (procIdx < this->procInstr.size())
+    {
+        this->procInstr[procIdx]++;
+        this->procCycles[procIdx] += cycles;
+        this->procTime[procIdx] += waitTime;
+
+        if (device == DEV_PROCESSOR)
+        {
+            this->procCpuTime[procIdx] += waitTime;
+        }
+    }
+}
+
+/**
+ * @brief      Records one handled I/O completion interrupt.
+ *
+ * @param[in]  costUs  The handling cost (us)
+ */
+void SimStats::recordInterrupt(unsigned long costUs)
+{
+    this->interrupts++;
+    this->interruptUs += costUs;
+}
+
+/**
+ * @brief      Records one fork/join region run by a process. The instructions
+ *             of its threads are recorded with record() as they execute.
+ *
+ * @param[in]  procIdx  The process index (pid - 1)
+ * @param[in]  threads  The number of threads, counting the main thread
+ * @param[in]  workUs   The time the instructions of all threads took (us)
+ * @param[in]  spanUs   The time from fork to join (us)
+ */
+void SimStats::recordRegion(unsigned procIdx, unsigned threads, 
+                            unsigned long long workUs, unsigned long long spanUs)
+{
+    if (procIdx < this->procRegions.size())
+    {
+        this->procRegions[procIdx]++;
+        this->procThreads[procIdx] = std::max(this->procThreads[procIdx], 
+                                              (unsigned long long) threads);
+        this->procWorkUs[procIdx] += workUs;
+        this->procSpanUs[procIdx] += spanUs;
+    }
+}
+
+/**
+ * @brief      Gets the number of fork/join regions run by all processes.
+ *
+ * @return     The number of regions.
+ */
+unsigned long long SimStats::getRegions() const
+{
+    unsigned long long regions = 0;
+
+    for (unsigned long long count: this->procRegions)
+    {
+        regions += count;
+    }
+
+    return regions;
+}
+
+/**
+ * @brief      Records one dispatch of a process.
+ *
+ * @param[in]  switched    True if it switched to a different process
+ * @param[in]  dispatchUs  The dispatch cost (us)
+ * @param[in]  switchUs    The state save/restore cost (us)
+ * @param[in]  refillUs    The cache refill penalty (us)
+ */
+void SimStats::recordDispatch(bool switched, unsigned long dispatchUs, 
+                              unsigned long switchUs, unsigned long refillUs)
+{
+    this->dispatches++;
+    this->dispatchUs += dispatchUs;
+
+    if (switched)
+    {
+        this->switches++;
+        this->switchUs += switchUs;
+        this->refillUs += refillUs;
+    }
+}
+
+/**
+ * @brief      Generates a compact summary of all counters.
+ *
+ * @param[in]  wallTime  The wall time of the run (s)
+ * @param[in]  simTime   The simulated time of the run (s)
+ *
+ * @return     The summary string
+ */
+std::string SimStats::genSummary(double wallTime, double simTime) const
+{
+    std::ostringstream out;
+
+    out << std::fixed << std::setprecision(3);
+    out << "Simulation summary\n";
+    out << "Wall time: " << wallTime << " s, processes: " 
+        << this->procInstr.size() << ", instructions: " << this->totalInstr;
+
+    if (wallTime > 0.0)
+    {
+        out << " (" << this->totalInstr / wallTime << " instr/s)";
+    }
+
+    out << "\nSimulated time: " << simTime << " s";
+
+    out << "\n\n" << std::left << std::setw(16) << "Device" << std::right 
+        << std::setw(12) << "Ops" << std::setw(14) << "Cycles" 
+        << std::setw(16) << "Time (ms)" << "\n";
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        out << std::left << std::setw(16) << DEVICE_NAMES[d] << std::right 
+            << std::setw(12) << this->devOps[d] 
+            << std::setw(14) << this->devCycles[d] 
+            << std::setw(16) << this->devTime[d] << "\n";
+    }
+
+    out << "Hard drive units:";
+    for (unsigned u = 0; u < this->hdUnitOps.size(); u++)
+    {
+        out << " " << u << "=" << this->hdUnitOps[u];
+    }
+
+    out << "\nProjector units:";
+    for (unsigned u = 0; u < this->projUnitOps.size(); u++)
+    {
+        out << " " << u << "=" << this->projUnitOps[u];
+    }
+
+    out << "\nInterrupts: " << this->interrupts << " (" 
+        << this->interruptUs / 1000.0 << " ms handling)";
+
+    out << "\n\n" << std::left << std::setw(16) << "Instruction" << std::right 
+        << std::setw(12) << "Count" << std::setw(14) << "Cycles" << "\n";
+
+    for (unsigned c = 0; c < 4; c++)
+    {
+        for (unsigned d = 0; d < NUM_DESCRIPTORS; d++)
+        {
+            if (this->typeCount[c][d] > 0)
+            {
+                std::string type = std::string(1, STATS_CODES[c]) + "{" + 
+                                   DESCRIPTOR_NAMES[d] + "}";
+
+                out << std::left << std::setw(16) << type << std::right 
+                    << std::setw(12) << this->typeCount[c][d] 
+                    << std::setw(14) << this->typeCycles[c][d] << "\n";
+            }
+        }
+    }
+
+    out << "\n" << std::setw(8) << "PID" << std::setw(12) << "Instr" 
+        << std::setw(14) << "Cycles" << std::setw(16) << "Time (ms)" << "\n";
+
+    for (unsigned p = 0; p < this->procInstr.size(); p++)
+    {
+        out << std::setw(8) << p + 1 << std::setw(12) << this->procInstr[p] 
+            << std::setw(14) << this->procCycles[p] 
+            << std::setw(16) << this->procTime[p] << "\n";
+    }
+
+    out << "\n";
+
+    return out.str();
+}
+
+/**
+ * @brief      Appends all counters to a checkpoint.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void SimStats::save(Checkpoint &ckpt) const
+{
+    const std::vector<unsigned long long> *unitVecs[] = { 
+        &this->hdUnitOps, &this->projUnitOps, &this->procInstr, &this->procCycles,
+        &this->procRegions, &this->procThreads, &this->procWorkUs, &this->procSpanUs
+    };
+
+    ckpt.putUInt(this->totalInstr);
+    ckpt.putUInt(this->interrupts);
+    ckpt.putUInt(this->interruptUs);
+    ckpt.putUInt(this->dispatches);
+    ckpt.putUInt(this->switches);
+    ckpt.putUInt(this->dispatchUs);
+    ckpt.putUInt(this->switchUs);
+    ckpt.putUInt(this->refillUs);
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        ckpt.putUInt(this->devOps[d]);
+        ckpt.putUInt(this->devCycles[d]);
+        ckpt.putDouble(this->devTime[d]);
+    }
+
+    for (unsigned c = 0; c < 4; c++)
+    {
+        for (unsigned d = 0; d < NUM_DESCRIPTORS; d++)
+        {
+            ckpt.putUInt(this->typeCount[c][d]);
+            ckpt.putUInt(this->typeCycles[c][d]);
+        }
+    }
+
+    for (const std::vector<unsigned long long> *vec: unitVecs)
+    {
+        ckpt.putUInt(vec->size());
+
+        for (unsigned long long count: *vec)
+        {
+            ckpt.putUInt(count);
+        }
+    }
+
+    for (double time: this->procTime)
+    {
+        ckpt.putDouble(time);
+    }
+
+    for (double time: this->procCpuTime)
+    {
+        ckpt.putDouble(time);
+    }
+}
+
+/**
+ * @brief      Restores all counters from a checkpoint. The counters must have 
+ *             been reset() for the same processes as when they were saved; 
+ *             the number of hard drive and projector units may differ.
+ *
+ * @param      ckpt  The checkpoint
+ */
+void SimStats::restore(Checkpoint &ckpt)
+{
+    std::vector<unsigned long long> *unitVecs[] = { 
+        &this->hdUnitOps, &this->projUnitOps, &this->procInstr, &this->procCycles,
+        &this->procRegions, &this->procThreads, &this->procWorkUs, &this->procSpanUs
+    };
+
+    this->totalInstr = ckpt.getUInt();
+    this->interrupts = ckpt.getUInt();
+    this->interruptUs = ckpt.getUInt();
+    this->dispatches = ckpt.getUInt();
+    this->switches = ckpt.getUInt();
+    this->dispatchUs = ckpt.getUInt();
+    this->switchUs = ckpt.getUInt();
+    this->refillUs = ckpt.getUInt();
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        this->devOps[d] = ckpt.getUInt();
+        this->devCycles[d] = ckpt.getUInt();
+        this->devTime[d] = ckpt.getDouble();
+    }
+
+    for (unsigned c = 0; c < 4; c++)
+    {
+        for (unsigned d = 0; d < NUM_DESCRIPTORS; d++)
+        {
+            this->typeCount[c][d] = ckpt.getUInt();
+            this->typeCycles[c][d] = ckpt.getUInt();
+        }
+    }
+
+    for (unsigned v = 0; v < sizeof(unitVecs) / sizeof(unitVecs[0]); v++)
+    {
+        std::vector<unsigned long long> &vec = *unitVecs[v];
+        unsigned long long size = ckpt.getUInt();
+
+        // unit counters follow the config, process counters the metadata
+        if (v >= 2 && size != vec.size())
+        {
+            throw std::string("Error: checkpoint does not match metadata");
+        }
+
+        for (unsigned long long k = 0; k < size; k++)
+        {
+            unsigned long long count = ckpt.getUInt();
+
+            if (k < vec.size())
+            {
+                vec[k] = count;
+            }
+        }
+    }
+
+    for (double &time: this->procTime)
+    {
+        time = ckpt.getDouble();
+    }
+
+    for (double &time: this->procCpuTime)
+    {
+        time = ckpt.getDouble();
+    }
+}
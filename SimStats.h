@@ -0,0 +1,237 @@
+/**
+ * @file SimStats.h
+ * 
+ * @brief Definition file for SimStats class
+ * 
+ * @details Specifies all member methods of the SimStats class, which 
+ *          accumulates aggregate execution counters per device, per process and
+ *          per instruction type in flat arrays
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          genSummary() reports the simulated time on its own line
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          Add recordRegion(), getRegions() and the per-process thread 
+ *          region getters
+ * 
+ * @version 1.05
+ *          Adam Landis (19 October 2026)
+ *          Add the processor time of each process (procCpuTime) and the 
+ *          per-process getters
+ * 
+ * @version 1.04
+ *          Adam Landis (19 October 2026)
+ *          Add recordDispatch() and the dispatch and context switch getters
+ * 
+ * @version 1.03
+ *          Adam Landis (19 October 2026)
+ *          Add recordInterrupt() and getInterrupts()
+ * 
+ * @version 1.02
+ *          Adam Landis (19 October 2026)
+ *          Add getDeviceOps() and getDeviceTime()
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add save() and restore() for checkpoints
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of SimStats class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef SIM_STATS_H
+#define SIM_STATS_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <vector>       // per-process and per-unit counters
+#include <sstream>      // ostringstream
+#include <iomanip>      // setw, setprecision
+#include <algorithm>    // std::max
+
+#include "MetadataInstruction.h"
+#include "Checkpoint.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const std::string STATS_CODES = "PMIO";
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class SimStats
+{
+public:
+    SimStats();
+
+    void reset(unsigned numProcesses, unsigned numHD, unsigned numProj);
+    void record(unsigned procIdx, const MetadataInstruction &instr, 
+                unsigned long cycles, double waitTime, unsigned unit);
+    void recordInterrupt(unsigned long costUs);
+    void recordDispatch(bool switched, unsigned long dispatchUs, 
+                        unsigned long switchUs, unsigned long refillUs);
+    void recordRegion(unsigned procIdx, unsigned threads, 
+                      unsigned long long workUs, unsigned long long spanUs);
+    unsigned long long getRegions() const;
+    std::string genSummary(double wallTime, double simTime) const;
+    void save(Checkpoint &ckpt) const;
+    void restore(Checkpoint &ckpt);
+
+    /**
+     * @brief      Gets the total number of instructions executed.
+     *
+     * @return     The number of instructions.
+     */
+    inline unsigned long long getTotalInstr() const { return this->totalInstr; }
+
+    /**
+     * @brief      Gets the number of operations executed on a device.
+     *
+     * @param[in]  dev   The device
+     *
+     * @return     The number of operations.
+     */
+    inline unsigned long long getDeviceOps(Device dev) const { return this->devOps[dev]; }
+
+    /**
+     * @brief      Gets the time spent on a device.
+     *
+     * @param[in]  dev   The device
+     *
+     * @return     The time in milliseconds.
+     */
+    inline double getDeviceTime(Device dev) const { return this->devTime[dev]; }
+
+    /**
+     * @brief      Gets the number of I/O completion interrupts handled.
+     *
+     * @return     The number of interrupts.
+     */
+    inline unsigned long long getInterrupts() const { return this->interrupts; }
+
+    /**
+     * @brief      Gets the number of times a process was dispatched.
+     *
+     * @return     The number of dispatches.
+     */
+    inline unsigned long long getDispatches() const { return this->dispatches; }
+
+    /**
+     * @brief      Gets the number of dispatches that switched to a different 
+     *             process.
+     *
+     * @return     The number of context switches.
+     */
+    inline unsigned long long getSwitches() const { return this->switches; }
+
+    /**
+     * @brief      Gets the time spent dispatching.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getDispatchUs() const { return this->dispatchUs; }
+
+    /**
+     * @brief      Gets the time spent saving and restoring process state.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getSwitchUs() const { return this->switchUs; }
+
+    /**
+     * @brief      Gets the time spent refilling cold caches after switches.
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getRefillUs() const { return this->refillUs; }
+
+    /**
+     * @brief      Gets the number of instructions a process executed.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The number of instructions.
+     */
+    inline unsigned long long getProcInstr(unsigned procIdx) const { return this->procInstr[procIdx]; }
+
+    /**
+     * @brief      Gets the time a process spent executing instructions.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The time in milliseconds.
+     */
+    inline double getProcTime(unsigned procIdx) const { return this->procTime[procIdx]; }
+
+    /**
+     * @brief      Gets the time a process spent on the processor.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The time in milliseconds.
+     */
+    inline double getProcCpuTime(unsigned procIdx) const { return this->procCpuTime[procIdx]; }
+
+    /**
+     * @brief      Gets the number of fork/join regions a process ran.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The number of regions.
+     */
+    inline unsigned long long getProcRegions(unsigned procIdx) const { return this->procRegions[procIdx]; }
+
+    /**
+     * @brief      Gets the most threads a process ran at once, counting its 
+     *             main thread.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The number of threads (0 if it ran no region).
+     */
+    inline unsigned long long getProcThreads(unsigned procIdx) const { return this->procThreads[procIdx]; }
+
+    /**
+     * @brief      Gets the time the instructions of a process's regions took,
+     *             added up over all its threads.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getProcWorkUs(unsigned procIdx) const { return this->procWorkUs[procIdx]; }
+
+    /**
+     * @brief      Gets the time from fork to join of a process's regions.
+     *
+     * @param[in]  procIdx  The process index (pid - 1)
+     *
+     * @return     The time in microseconds.
+     */
+    inline unsigned long long getProcSpanUs(unsigned procIdx) const { return this->procSpanUs[procIdx]; }
+private:
+    unsigned long long totalInstr;
+    unsigned long long interrupts, interruptUs;
+    unsigned long long dispatches, switches, dispatchUs, switchUs, refillUs;
+    unsigned long long devOps[NUM_DEVICES];
+    unsigned long long devCycles[NUM_DEVICES];
+    double devTime[NUM_DEVICES];
+    unsigned long long typeCount[4][NUM_DESCRIPTORS];
+    unsigned long long typeCycles[4][NUM_DESCRIPTORS];
+    std::vector<unsigned long long> hdUnitOps, projUnitOps;
+    std::vector<unsigned long long> procInstr, procCycles;
+    std::vector<unsigned long long> procRegions, procThreads, procWorkUs, procSpanUs;
+    std::vector<double> procTime, procCpuTime;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // SIM_STATS_H
+//
@@ -5,6 +5,195 @@
  * 
  * @details Implements all member methods of Simulation class
  * 
+ * @version 1.34
+ *          Adam Landis (19 October 2026)
+ *          Use mixBits() from helpers
+ * 
+ * @version 1.33
+ *          Adam Landis (19 October 2026)
+ *          Initialize the memory address of executeInstruction() for non-memory
+ *          instructions
+ * 
+ * @version 1.32
+ *          Adam Landis (19 October 2026)
+ *          forkVariants() runs a variant on the calling thread if its thread 
+ *          cannot be created
+ * 
+ * @version 1.31
+ *          Adam Landis (19 October 2026)
+ *          restoreCheckpoint() resets the next block pointer if it is beyond 
+ *          the end of system memory
+ * 
+ * @version 1.30
+ *          Adam Landis (19 October 2026)
+ *          Cap the tickets of a process at MAX_TICKETS
+ * 
+ * @version 1.29
+ *          Adam Landis (19 October 2026)
+ *          Time the run on a wall Timer for the summary, which reports the 
+ *          simulated time separately
+ * 
+ * @version 1.28
+ *          Adam Landis (19 October 2026)
+ *          - Run fork/join regions (T{fork} ... T{exit} ... T{join}) as 
+ *            threads of their process on "Processor quantity" processors, 
+ *            logging each thread's instructions and a thread report with the
+ *            speedup and parallel efficiency of each process.
+ *          - Allow variants to change the number of processors, and compare
+ *            thread speedup in the what-if report.
+ * 
+ * @version 1.27
+ *          Adam Landis (19 October 2026)
+ *          - Model processor P-states when "DVFS Governor Code" is set: 
+ *            P{run} instructions take longer at lower frequencies, the 
+ *            governor picks the P-state from the utilization of each sample
+ *            interval, and a power report gives the energy, average power 
+ *            and energy-delay product of the run.
+ *          - Allow variants to switch the governor, and compare energy in 
+ *            the what-if report.
+ * 
+ * @version 1.26
+ *          Adam Landis (19 October 2026)
+ *          - Load the metadata files in "Tenant File Paths" as further 
+ *            tenants after the "File Path" one; their processes share the 
+ *            processor and devices, and "Tenant Weights" multiplies the 
+ *            tickets of each tenant's processes.
+ *          - Log a tenant report at the end of a run with several tenants.
+ * 
+ * @version 1.25
+ *          Adam Landis (19 October 2026)
+ *          Create processes and PCBs in one pass over the parser's process 
+ *          index instead of rescanning the instruction arena
+ * 
+ * @version 1.24
+ *          Adam Landis (19 October 2026)
+ *          With "Log Format" set to "Binary", encode every log line through 
+ *          EventLog (emitEvent()) and log reports with logText(); text lines 
+ *          are only formatted when a text log or the timeline takes them
+ * 
+ * @version 1.23
+ *          Adam Landis (19 October 2026)
+ *          - Charge "Dispatch Cost {usec}" for every dispatch, and "Context 
+ *            Switch Cost {usec}" and "Cache Refill Penalty {usec}" when it 
+ *            switches to a different process (dispatchProcess()); count 
+ *            voluntary and involuntary switches per process and log a 
+ *            context switch report at the end of the run.
+ *          - Allow variants to override the three costs, and compare context
+ *            switches and switching time in the what-if report.
+ * 
+ * @version 1.22
+ *          Adam Landis (19 October 2026)
+ *          - With "L1 cache size {kbytes}" set, memory instructions drive an
+ *            address stream over the process's allocated blocks through a 
+ *            cache hierarchy (CacheModel) and take time by their access 
+ *            latencies instead of the flat memory cycle time, and a cache 
+ *            report is logged at the end of the run.
+ *          - executeMemInstruction() takes the time of the operation.
+ * 
+ * @version 1.21
+ *          Adam Landis (19 October 2026)
+ *          - With "I/O Coalesce Window {usec}" set, I/O requests to a device 
+ *            unit in the same direction are merged in the unit's submission 
+ *            queue (IOBatcher) and served as one operation, and a coalescing 
+ *            report is logged at the end of the run.
+ * 
+ * @version 1.20
+ *          Adam Landis (19 October 2026)
+ *          - Add an optional hard drive model ("Disk Scheduling Code"): each 
+ *            drive queues its requests and serves them in FCFS, SSTF, SCAN 
+ *            or C-LOOK order, with seek and rotational latency, and a disk 
+ *            report is logged at the end of the run.
+ *          - Allow variants to override "Disk Scheduling Code".
+ * 
+ * @version 1.19
+ *          Adam Landis (19 October 2026)
+ *          - Move the per-instruction dispatch work into stepProcess().
+ *          - With SIM_COROUTINES, FIFO, PS and SJF processes run as 
+ *            coroutines (runProcess()) that suspend while waiting for I/O, 
+ *            and completions are timed by the dispatcher instead of device 
+ *            threads.
+ * 
+ * @version 1.18
+ *          Adam Landis (19 October 2026)
+ *          - Device threads post I/O completion records to a lock-free 
+ *            IOCompletionQueue instead of being joined, and the scheduler 
+ *            drains it between instructions as simulated interrupts, each 
+ *            charged "Interrupt Cost {usec}". With "I/O Mode" set to 
+ *            "Interrupt", FIFO, PS and SJF run other processes while a 
+ *            process waits for I/O.
+ *          - Device units serve I/O in issue order by their free time instead
+ *            of per-device semaphores.
+ * 
+ * @version 1.17
+ *          Adam Landis (19 October 2026)
+ *          - Publish live snapshots (clock, process counts, busy device units,
+ *            memory in use) to a LiveStats file set with setLiveStats().
+ *          - Mark I/O processes as waiting before their device is used.
+ * 
+ * @version 1.16
+ *          Adam Landis (19 October 2026)
+ *          - Profile process creation, scheduling, execution, logging, I/O 
+ *            threads and checkpoints with PROFILE_SCOPE.
+ * 
+ * @version 1.15
+ *          Adam Landis (19 October 2026)
+ *          - Add what-if forking: a run stopped at a given time with 
+ *            setStopTime() can fork variants with forkVariants(), which share
+ *            the parsed instructions and process table, restore the stopped 
+ *            state and run in parallel threads; results are reported side by
+ *            side.
+ *          - Give each Simulation its own memory mutex and device semaphores.
+ *          - Record process completion times for turnaround statistics.
+ * 
+ * @version 1.14
+ *          Adam Landis (19 October 2026)
+ *          - Save the full simulation state to a binary checkpoint every 
+ *            "Checkpoint Interval {msec}" of simulated time, and resume a run
+ *            from a checkpoint set with setResumeCheckpoint().
+ *          - Continue a restored running process from its PC.
+ * 
+ * @version 1.13
+ *          Adam Landis (19 October 2026)
+ *          - Take all timestamps and waits from a SimClock, which can run in 
+ *            virtual time ("Clock Mode: Virtual") for fast deterministic runs.
+ *          - Route every log line through emitLog(), which also records it to
+ *            the Timeline set with setTimeline(), even when logging is off.
+ *          - Remove the wait() functions in favour of SimClock::advance().
+ * 
+ * @version 1.12
+ *          Adam Landis (19 October 2026)
+ *          - Keep PCBs in a structure-of-arrays PCBTable with a ready bitmap 
+ *            instead of copying them through readyQueue.
+ *          - Replace sortReadyQueue() with pickNextProcess(), a vectorized 
+ *            min/max search over the ready set.
+ * 
+ * @version 1.11
+ *          Adam Landis (19 October 2026)
+ *          - Build processes as spans of the shared instruction arena instead 
+ *            of copying the metadata queue and per-process vectors.
+ *          - Pass instructions by const reference through the execution loop.
+ * 
+ * @version 1.10
+ *          Adam Landis (19 October 2026)
+ *          - Add "Log Summary" mode which skips all event logging and prints
+ *            aggregate SimStats counters at the end of the run.
+ *          - executeInstruction() now takes the cycles to execute.
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          - Format all log lines into a reusable per-thread LogBuffer with 
+ *            fixed-point timestamps instead of concatenating strings.
+ *          - Skip per-instruction log lines when "Log Level" is "Process", or
+ *            compile them out with -DSIM_LOG_INSTRUCTIONS=0.
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          - Add STRIDE and LOTTERY proportional-share scheduling with 
+ *            per-process tickets taken from A{begin} and a share report.
+ *          - Detect process boundaries by code/descriptor instead of string
+ *            comparison so A{begin} can carry a ticket count.
+ *          - Move per-instruction execution into executeInstruction().
+ * 
  * @version 1.07
  *          Adam Landis (24 April 2019)
  *          - Change startSimulation() implementation to use readyQueue.
@@ -55,15 +244,31 @@
 // Header Files ////////////////////////////////////////////////////////////////
 //
 #include "Simulation.h"
+#include "Profiler.h"
+
+#include <cmath>        // llround
+#include <cstdlib>      // strtod
 //
 // Global Constant Definitions /////////////////////////////////////////////////
 // 
-const std::string CPU_SCHEDULING_CODES[3] = { "FIFO", "PS", "SJF" };
+const std::string CPU_SCHEDULING_CODES[5] = { "FIFO", "PS", "SJF", "STRIDE", "LOTTERY" };
+const unsigned long LOTTERY_SEED = 446;
+const unsigned NO_PROCESS = ~0u;
+const unsigned THREAD_FORK = 0x80000000u;       // region item forking a thread
+const std::string VARIANT_SETTINGS[12] = {
+    "Hard drive quantity", "Projector quantity", "System memory", 
+    "Memory block size", "Processor Quantum Number", "CPU Scheduling Code",
+    "Disk Scheduling Code", "Context Switch Cost", "Dispatch Cost", 
+    "Cache Refill Penalty", "DVFS Governor Code", "Processor quantity"
+};
 //
 // Global Variable Definitions /////////////////////////////////////////////////
 //
-pthread_mutex_t mutex;                          // mutex for memory mgmt
-sem_t semHD, semProj, semKB, semMon, semScan;   // semaphores for resource mgmt
+static thread_local LogBuffer logBuf;           // reusable log line buffer
+//
+// Local Function Prototypes ///////////////////////////////////////////////////
+//
+static std::vector<std::string> splitList(const std::string &list);
 //
 // Class Member Implementation /////////////////////////////////////////////////
 //
@@ -73,7 +278,15 @@ sem_t semHD, semProj, semKB, semMon, semScan;   // semaphores for resource mgmt
  *
  * @param[in]  configFilename  The configuration filename
  */
-Simulation::Simulation(const std::string& configFilename): configFilename(configFilename)
+Simulation::Simulation(const std::string& configFilename): 
+    configFilename(configFilename), 
+    timeline(NULL),
+    resumeCkpt(NULL),
+    stopUs(0),
+    stopped(false),
+    isVariant(false),
+    liveStats(NULL),
+    liveIntervalUs(0)
 {
     this->config = new Config(configFilename);
 
@@ -84,68 +297,170 @@ Simulation::Simulation(const std::string& configFilename): configFilename(config
         throw std::string("Error: 'File Path' missing from config file");
     }
 
-    this->metadata = new Metadata(metadataFilename, this->config);
-    this->metadata->setSemPtrs(&semHD, &semProj, &semKB, &semMon, &semScan);
-    this->metadata->parseMetadataFile();
+    std::vector<std::string> filenames = splitList(this->config->getSettingVal("Tenant File Paths"));
+    std::vector<std::string> weights = splitList(this->config->getSettingVal("Tenant Weights"));
+
+    filenames.insert(filenames.begin(), metadataFilename);
+
+    if (!weights.empty() && weights.size() != filenames.size())
+    {
+        throw std::string("Error: 'Tenant Weights' must give one weight per tenant");
+    }
+
+    for (unsigned t = 0; t < filenames.size(); t++)
+    {
+        if (!weights.empty() && !isPositiveInteger(weights[t]))
+        {
+            throw std::string("Error: invalid tenant weight \"" + weights[t] + "\"");
+        }
+
+        this->tenants.push_back(std::make_shared<Metadata>(filenames[t], this->config));
+        this->tenants.back()->parseMetadataFile();
+        this->tenantWeights.push_back(weights.empty() ? 1 : 
+                                      (unsigned) strToUnsignedLong(weights[t]));
+    }
+}
+
+/**
+ * @brief      Constructs a what-if variant of a simulation stopped with 
+ *             setStopTime(). The variant shares the base's parsed instructions
+ *             and process table, which are never modified, and resumes from a 
+ *             copy of the state the base stopped in, with some settings 
+ *             overridden.
+ *
+ * @param[in]  base  The stopped base simulation
+ * @param[in]  spec  The overrides as "key=value" pairs separated by ';' 
+ *                   (e.g. "Hard drive quantity=4;System memory=2048")
+ */
+Simulation::Simulation(const Simulation &base, const std::string &spec): 
+    configFilename(base.configFilename),
+    tenants(base.tenants),
+    tenantWeights(base.tenantWeights),
+    pcbTable(base.pcbTable),
+    processVector(base.processVector),
+    timeline(NULL),
+    resumeCkpt(NULL),
+    stopUs(0),
+    stopped(false),
+    isVariant(true),
+    forkCkpt(base.forkCkpt),
+    liveStats(NULL),
+    liveIntervalUs(0)
+{
+    std::string baseCode, code;
+    size_t pos = 0;
+
+    this->config = new Config(this->configFilename);
+    baseCode = this->config->getSettingVal("CPU Scheduling Code");
+
+    while (pos < spec.length())
+    {
+        size_t end = spec.find(';', pos);
+        std::string pair = spec.substr(pos, end == std::string::npos ? 
+                                            std::string::npos : end - pos);
+        size_t eq = pair.find('=');
+        bool known = false;
+
+        pos = (end == std::string::npos) ? spec.length() : end + 1;
+
+        if (pair.empty())
+        {
+            continue;
+        }
+
+        std::string key = (eq == std::string::npos) ? pair : pair.substr(0, eq);
+        std::string value = (eq == std::string::npos) ? "" : pair.substr(eq + 1);
+
+        for (const std::string& name: VARIANT_SETTINGS)
+        {
+            known = known || (key == name);
+        }
+
+        if (!known || value.empty() || 
+            (key != "CPU Scheduling Code" && key != "Disk Scheduling Code" && 
+             key != "DVFS Governor Code" && !isPositiveInteger(value)))
+        {
+            delete this->config;
+            throw std::string("Error: invalid variant setting \"" + pair + "\"");
+        }
+
+        this->config->setSettingVal(key, value);
+    }
+
+    code = this->config->getSettingVal("CPU Scheduling Code");
+
+    if (code != baseCode && 
+        (code == "STRIDE" || code == "LOTTERY" || 
+         baseCode == "STRIDE" || baseCode == "LOTTERY"))
+    {
+        delete this->config;
+        throw std::string("Error: variant cannot switch scheduling from " + 
+                          baseCode + " to " + code);
+    }
+
+    // skip the config filename that heads every checkpoint
+    this->forkCkpt.getString();
+    this->resumeCkpt = &this->forkCkpt;
+}
+
+/**
+ * @brief      Destroys the object, flushing and closing the log.
+ */
+Simulation::~Simulation()
+{
+    delete this->config;
 }
 
 /**
  * @brief      Creates processes for each process in metadata, along with its 
- *             PCB.
+ *             PCB, from the process index built by the parser. The processes
+ *             of each tenant follow those of the tenant before it. The cycle 
+ *             count of each A{begin} instruction is taken as the number of 
+ *             scheduling tickets for the process (0 selects the default), 
+ *             multiplied by the weight of its tenant.
  */     
 void Simulation::createProcesses()
 {
-    int i = 1;
-    metadataQueue mdQueueCopy = this->metadata->getMetadataQueue();
+    PROFILE_SCOPE(PHASE_CREATE_PROCESSES);
 
-    while (!mdQueueCopy.empty())
-    {
-        MetadataInstruction instr = mdQueueCopy.front();
-        
-        if (instr.toString() == "A{begin}0")
-        {
-            mdQueueCopy.pop();
-            
-            // Create new Process
-            unsigned int numInstr = 0, numIOInstr = 0;
-            Process process(i);
-            std::vector<MetadataInstruction> instrVector;
+    std::shared_ptr<std::vector<Process> > processes = std::make_shared<std::vector<Process> >();
+    size_t numProcesses = 0;
+    unsigned i = 1;
 
-            instr = mdQueueCopy.front();
+    for (const std::shared_ptr<Metadata> &tenant: this->tenants)
+    {
+        numProcesses += tenant->getProcessSpans().size();
+    }
 
-            while (instr.toString() != "A{finish}0")
-            {
-                instrVector.push_back(instr);
+    processes->reserve(numProcesses);
 
-                if (instr.getCode() == 'I' || instr.getCode() == 'O')
-                {
-                    numIOInstr++;
-                    numInstr++;
-                }
-                else
-                {
-                    numInstr++;
-                }
+    for (unsigned t = 0; t < this->tenants.size(); t++)
+    {
+        const instructionArena &arena = this->tenants[t]->getInstrArena();
 
-                mdQueueCopy.pop();
-                instr = mdQueueCopy.front();
-            }
-            process.setInstrVector(instrVector);
+        for (const processSpan &span: this->tenants[t]->getProcessSpans())
+        {
+            // Create new Process
+            Process process(i);
+            process.setInstrSpan(&arena, span.offset, span.numInstr);
+            process.setTenant(t);
+            processes->push_back(process);
             // END Create new Process
 
-            this->processVector.push_back(process);
-
             // Create new PCB
-            PCB pcb(i, numInstr, numIOInstr);
+            PCB pcb(i, span.numInstr, span.numIOInstr);
+            unsigned long long tickets = (span.tickets == 0 ? DEFAULT_TICKETS : span.tickets);
+            tickets *= this->tenantWeights[t];
+            pcb.setTickets((unsigned) std::min(tickets, (unsigned long long) MAX_TICKETS));
             // END Create new PCB
 
             pcb.setState(READY);
-            this->readyQueue.push(pcb);
+            this->pcbTable.add(pcb);
             i++;
         }
-
-        mdQueueCopy.pop();
     }
+
+    this->processVector = processes;
 }
 
 /**
@@ -153,267 +468,2680 @@ void Simulation::createProcesses()
  */
 void Simulation::startSimulation()
 {
-    Timer myTimer;
-    std::string data;
-    float duration;
-    unsigned numHD, countHD = 0,
-             numProj, countProj = 0,
-             sysMem, memBlockSize, nextBlockPtr = 0;
+    unsigned idx;
 
     numHD   = (unsigned) strToUnsignedLong(this->config->getSettingVal("Hard drive quantity"));
     numProj = (unsigned) strToUnsignedLong(this->config->getSettingVal("Projector quantity"));
+    numCPUs = (unsigned) strToUnsignedLong(this->config->getSettingVal("Processor quantity"));
+    numCPUs = std::max(numCPUs, 1u);
 
     sysMem       = (unsigned) strToUnsignedLong(this->config->getSettingVal("System memory"));
     memBlockSize = (unsigned) strToUnsignedLong(this->config->getSettingVal("Memory block size"));
 
-    pthread_mutex_init(&mutex, NULL);
+    countHD = countProj = nextBlockPtr = 0;
+    quiet = this->config->isSummaryLog() || isVariant;
+    textLog = !quiet && this->config->logsText();
+    binaryLog = !quiet && this->config->logsBinary();
+    stopped = false;
+
+    pthread_mutex_init(&memMutex, NULL);
+
+    if (!processVector)
+    {
+        createProcesses();
+    }
+
+    stats.reset(pcbTable.size(), numHD, numProj);
+    procEndUs.assign(pcbTable.size(), 0);
 
-    sem_init(&semHD,   0, numHD);
-    sem_init(&semProj, 0, numProj);
-    sem_init(&semKB,   0, 1);
-    sem_init(&semMon,  0, 1);
-    sem_init(&semScan, 0, 1);
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        busyUnits[d] = 0;
+    }
 
-    createProcesses();
+    nextLiveUs = 0;
 
     std::string schedCode = this->config->getSettingVal("CPU Scheduling Code");
-    sortReadyQueue(schedCode);
+    bool isShareSched = (schedCode == "STRIDE" || schedCode == "LOTTERY");
+    bool resumed;
 
-    std::cout << std::setprecision(6) << std::fixed;
+    // proportional-share dispatch keeps the processor through I/O
+    interruptIO = this->config->usesInterruptIO() && !isShareSched;
+    interruptCostUs = strToUnsignedLong(this->config->getSettingVal("Interrupt Cost"));
+    ioSlots = std::vector<ioCompletion>(pcbTable.size());
+    ioInFlight = 0;
 
-    myTimer.startTimer();
+    while (!ioPending.empty())
+    {
+        ioPending.pop();
+    }
 
-    duration = myTimer.getDuration() / 1000.0f;
-    data = std::to_string(duration) + " - Simulator program starting\n";
-    this->config->logData(data);
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        unitFreeUs[d].assign((d == DEV_HARD_DRIVE) ? numHD : 
+                             (d == DEV_PROJECTOR) ? numProj : 1, 0);
+    }
+
+    std::string diskCode = this->config->getSettingVal("Disk Scheduling Code");
 
-    while (!readyQueue.empty())
+    disks.clear();
+
+    if (!diskCode.empty())
     {
-        duration = myTimer.getDuration() / 1000.0f;
-        
-        PCB tempPCB = readyQueue.front();
-        unsigned pid = tempPCB.getPID();
+        unsigned policy = 0;
+        unsigned long cylinders = strToUnsignedLong(this->config->getSettingVal("Disk cylinders"));
+        unsigned long seekUs = strToUnsignedLong(this->config->getSettingVal("Disk seek time"));
+        unsigned long rpm = strToUnsignedLong(this->config->getSettingVal("Disk RPM"));
+
+        while (policy < NUM_DISK_POLICIES && DISK_POLICY_NAMES[policy] != diskCode)
+        {
+            policy++;
+        }
+
+        if (policy == NUM_DISK_POLICIES)
+        {
+            throw std::string("Error: invalid disk scheduling code \"" + diskCode + "\"");
+        }
 
-        data  = std::to_string(duration) + " - OS: preparing process ";
-        data += std::to_string(pid) + "\n";
-        this->config->logData(data);
+        disks.assign(numHD, DiskScheduler((DiskPolicy) policy, 
+                                          cylinders ? cylinders : DEFAULT_DISK_CYLINDERS,
+                                          seekUs ? seekUs : DEFAULT_DISK_SEEK_US,
+                                          rpm ? rpm : DEFAULT_DISK_RPM));
+    }
 
-        duration = myTimer.getDuration() / 1000.0f;
-        data  = std::to_string(duration) + " - OS: starting process ";
-        data += std::to_string(pid) + "\n";
-        this->config->logData(data);
+    cache = CacheModel();
+    procBlocks.assign(pcbTable.size(), std::vector<unsigned>());
 
-        std::vector<MetadataInstruction> instrVector = processVector[pid-1].getInstrVector();
+    if (strToUnsignedLong(this->config->getSettingVal("L1 cache size")) != 0)
+    {
+        const std::string sizeKeys[NUM_CACHE_LEVELS] = {"L1 cache size", "L2 cache size", "LLC size"};
+        const std::string waysKeys[NUM_CACHE_LEVELS] = {"L1 cache associativity", 
+                                                        "L2 cache associativity", 
+                                                        "LLC associativity"};
+        std::string cacheCode = this->config->getSettingVal("Cache Replacement Code");
+        unsigned long lineSize = strToUnsignedLong(this->config->getSettingVal("Cache line size"));
+        unsigned policy = 0;
+
+        while (!cacheCode.empty() && policy < NUM_CACHE_POLICIES && 
+               CACHE_POLICY_NAMES[policy] != cacheCode)
+        {
+            policy++;
+        }
 
-        for (unsigned i = 0; i < instrVector.size(); i++)
+        if (policy == NUM_CACHE_POLICIES)
         {
-            MetadataInstruction instr = instrVector[i];
-            char code = instr.getCode();
-            std::string descriptor = instr.getDescriptor();
-            float wait_time = instr.getWaitTime();
-            unsigned memAddr;
-            std::string data;
-            
-            if (code == 'P')
-            {
-                tempPCB.setState(RUNNING);
-            }
+            throw std::string("Error: invalid cache replacement code \"" + cacheCode + "\"");
+        }
 
-            duration = myTimer.getDuration() / 1000.0f;
-            data = std::to_string(duration) + " - " + instr.genLogString(true, pid);
+        cache.setLine(lineSize ? lineSize : DEFAULT_CACHE_LINE, (CachePolicy) policy);
 
-            if (descriptor == "hard drive")
+        for (unsigned l = 0; l < NUM_CACHE_LEVELS; l++)
+        {
+            unsigned long sizeKB = strToUnsignedLong(this->config->getSettingVal(sizeKeys[l]));
+            unsigned long ways = strToUnsignedLong(this->config->getSettingVal(waysKeys[l]));
+
+            if (sizeKB != 0)
             {
-                data += std::to_string(countHD++ % numHD);
+                cache.addLevel(l, sizeKB, ways ? ways : DEFAULT_CACHE_WAYS);
             }
-            else if (descriptor == "projector")
+        }
+    }
+
+    std::string governorCode = this->config->getSettingVal("DVFS Governor Code");
+
+    power = PowerModel();
+
+    if (!governorCode.empty())
+    {
+        std::vector<std::string> pStates = splitList(this->config->getSettingVal("Processor P-states"));
+        unsigned long sampleMs = strToUnsignedLong(this->config->getSettingVal("DVFS Sample Interval"));
+        unsigned governor = 0;
+
+        while (governor < NUM_GOVERNORS && GOVERNOR_NAMES[governor] != governorCode)
+        {
+            governor++;
+        }
+
+        if (governor == NUM_GOVERNORS)
+        {
+            throw std::string("Error: invalid DVFS governor code \"" + governorCode + "\"");
+        }
+
+        for (unsigned k = 0; k < NUM_DEFAULT_PSTATES && pStates.empty(); k++)
+        {
+            power.addState(DEFAULT_PSTATE_MHZ[k], DEFAULT_PSTATE_VOLTS[k]);
+        }
+
+        // each P-state is given as "<MHz>@<volts>"
+        for (const std::string &pState: pStates)
+        {
+            size_t at = pState.find('@');
+            char *end = NULL;
+            double volts = (at == std::string::npos) ? 0.0 : 
+                           strtod(pState.c_str() + at + 1, &end);
+
+            if (at == std::string::npos || !isPositiveInteger(pState.substr(0, at)) || 
+                end == pState.c_str() + at + 1 || *end != '\0' || !(volts > 0.0))
             {
-                data += std::to_string(countProj++ % numProj);
+                throw std::string("Error: invalid P-state \"" + pState + "\"");
             }
 
-            data += "\n";
+            power.addState((unsigned) strToUnsignedLong(pState.substr(0, at)), volts);
+        }
 
-            this->config->logData(data);
+        power.setGovernor((DvfsGovernor) governor, 
+                          (sampleMs ? sampleMs : DEFAULT_DVFS_SAMPLE_MS) * 1000ULL);
+    }
 
-            if (code == 'I' || code == 'O')
-            {
-                tempPCB.setState(WAIT);
+    coalesceUs = strToUnsignedLong(this->config->getSettingVal("I/O Coalesce Window"));
+    batchers.clear();
 
-                pthread_t tid;
-                pthread_create(&tid, NULL, executeIOInstruction, (void*)&instr);
-                pthread_join(tid, NULL);
-            }
-            else if (code == 'M')
+    if (coalesceUs != 0)
+    {
+        for (unsigned d = 0; d < NUM_DEVICES; d++)
+        {
+            // the disk model queues hard drive requests itself
+            bool batched = (d != DEV_PROCESSOR && d != DEV_MEMORY && 
+                            (d != DEV_HARD_DRIVE || disks.empty()));
+
+            batchers.push_back(IOBatcher(coalesceUs, batched ? unitFreeUs[d].size() : 0));
+        }
+    }
+
+    ckptIntervalUs = strToUnsignedLong(this->config->getSettingVal("Checkpoint Interval")) * 1000ULL;
+    ckptFilename = this->config->getSettingVal("Checkpoint File Path");
+    nextCkptUs = ckptIntervalUs;
+    activeIdx = NO_PROCESS;
+    shareWindowOpen = true;
+    switchCostUs = strToUnsignedLong(this->config->getSettingVal("Context Switch Cost"));
+    dispatchCostUs = strToUnsignedLong(this->config->getSettingVal("Dispatch Cost"));
+    refillCostUs = strToUnsignedLong(this->config->getSettingVal("Cache Refill Penalty"));
+    lastIdx = NO_PROCESS;
+    lastVoluntary = false;
+
+    if (ckptIntervalUs != 0 && ckptFilename.empty())
+    {
+        throw std::string("Error: 'Checkpoint File Path' missing from config file");
+    }
+
+    std::cout << std::setprecision(6) << std::fixed;
+
+    wallTimer.startTimer();
+
+    if (this->resumeCkpt)
+    {
+        restoreCheckpoint();
+    }
+    else
+    {
+        clock.start(this->config->usesVirtualClock(), 0);
+
+        logEvent("Simulator program starting\n");
+    }
+
+    if (isShareSched)
+    {
+        runProportionalShare(schedCode);
+    }
+
+    resumed = (activeIdx != NO_PROCESS);
+    idx = activeIdx;
+
+#if SIM_COROUTINES
+    std::vector<ProcessTask> tasks(isShareSched ? 0 : pcbTable.size());
+#endif
+
+    while (!isShareSched && !stopped)
+    {
+        if (!resumed && !pickNextProcess(schedCode, idx))
+        {
+            // nothing is ready: idle until the next I/O completion, if any
+            if (!waitForIOCompletion())
             {
-                executeMemInstruction(instr, nextBlockPtr, memBlockSize, memAddr, sysMem);
+                break;
             }
-            else
+
+            continue;
+        }
+
+        unsigned pid = pcbTable.getPID(idx);
+
+        if (!resumed)
+        {
+            if (pcbTable.getPC(idx) == 0)
             {
-                wait(wait_time);
+                logEvent("OS: preparing process ", pid, "\n");
             }
 
+            pcbTable.setState(idx, RUNNING);
+            logEvent("OS: starting process ", pid, "\n");
+            dispatchProcess(idx);
+        }
+
+        resumed = false;
+        activeIdx = idx;
+
+#if SIM_COROUTINES
+        if (!tasks[idx].isValid())
+        {
+            tasks[idx] = runProcess(idx);
+        }
 
-            duration = myTimer.getDuration() / 1000.0f;
-            data = std::to_string(duration) + " - " + instr.genLogString(false, pid);
+        tasks[idx].resume();
+#else
+        const Process &process = (*processVector)[pid-1];
 
-            if (code == 'M' && descriptor == "allocate")
+        for (unsigned i = pcbTable.getPC(idx); i < process.getNumInstr(); i = pcbTable.getPC(idx))
+        {
+            if (!stepProcess(process, idx, i))
             {
-                data += " ";
-                data += uintToHexStr(memAddr);
+                break;
             }
+        }
+#endif
+
+        if (stopped)
+        {
+            break;
+        }
 
-            data += "\n";
-            
-            this->config->logData(data);
+        if (activeIdx == NO_PROCESS)
+        {
+            continue;
         }
 
-        duration = myTimer.getDuration() / 1000.0f;
-        data  = std::to_string(duration) + " - End process ";
-        data += std::to_string(pid) + "\n";
-        this->config->logData(data);
+        pcbTable.setState(idx, EXIT);
+        procEndUs[idx] = clock.getMicroseconds();
+        activeIdx = NO_PROCESS;
+        logEvent("End process ", pid, "\n");
 
-        readyQueue.pop();
+#if SIM_COROUTINES
+        tasks[idx] = ProcessTask();
+#endif
     }
 
-    duration = myTimer.getDuration() / 1000.0f;
-    data = std::to_string(duration) + " - Simulator program ending\n\n";
-    this->config->logData(data);
-}
-
-/**
- * @brief      Sorts the readyQueue according to given algorithm (PS, SJF, or 
- *             FCFS)
- *
- * @param[in]  algo  The scheduling algorithm
- */
-void Simulation::sortReadyQueue(std::string algo)
-{
-    std::vector<PCB> temp;
+    if (stopped)
+    {
+        // device threads still in flight post to this simulation's queue
+        while (ioInFlight > 0)
+        {
+            if (ioQueue.pop() != NULL)
+            {
+                ioInFlight--;
+            }
+        }
 
-    unsigned size = readyQueue.size();
+        this->config->flushLog();
+        return;
+    }
 
-    for (unsigned i = 0; i < size; i++)
+    if (power.getNumStates() != 0)
     {
-        temp.push_back(readyQueue.front());
-        readyQueue.pop();
+        power.update(clock.getMicroseconds());
     }
 
-    if (algo == "PS")
+    logEvent("Simulator program ending\n\n");
+
+    if (this->liveStats)
     {
-        std::sort(temp.begin(), temp.end(), by_largestNumIOInstr());
+        publishLiveStats(true);
     }
-    else if (algo == "SJF")
+
+    if (quiet && !isVariant)
     {
-        std::sort(temp.begin(), temp.end(), by_smallestNumInstr());
+        this->config->logData(stats.genSummary(wallTimer.getDuration() / 1000.0f, 
+                                               clock.getMicroseconds() / 1000000.0));
     }
-    else if (algo == "FCFS")
+
+    if (isShareSched && !isVariant)
     {
-        std::sort(temp.begin(), temp.end(), by_smallestPID());
+        logShareReport(schedCode);
     }
 
-    for (unsigned i = 0; i < size; i++)
+    if (!disks.empty() && !isVariant)
     {
-        readyQueue.push(temp[i]);
+        logDiskReport();
     }
-}
 
-/**
- * @brief      Prints the contents of readyQueue
- */
-void Simulation::printReadyQueue()
-{
-    std::queue<PCB> readyQueueCopy = this->readyQueue;
-    while (!readyQueue.empty())
+    if (!batchers.empty() && !isVariant)
     {
-        PCB tempPCB = this->readyQueue.front();
+        logCoalesceReport();
+    }
 
-        std::cout << tempPCB << std::endl;
+    if (cache.getNumLevels() != 0 && !isVariant)
+    {
+        logCacheReport();
+    }
 
-        readyQueue.pop();
+    if (power.getNumStates() != 0 && !isVariant)
+    {
+        logPowerReport();
     }
-}
 
-/**
- * @brief      Prints the contents of waitQueue
- */
-void Simulation::printWaitQueue()
-{
-    std::queue<PCB> readyQueueCopy = this->readyQueue;
-    while (!readyQueue.empty())
+    if ((switchCostUs != 0 || dispatchCostUs != 0 || refillCostUs != 0) && !isVariant)
     {
-        PCB tempPCB = this->readyQueue.front();
+        logSwitchReport(schedCode);
+    }
 
-        std::cout << tempPCB << std::endl;
+    if (this->tenants.size() > 1 && !isVariant)
+    {
+        logTenantReport();
+    }
 
-        readyQueue.pop();
+    if (stats.getRegions() != 0 && !isVariant)
+    {
+        logThreadReport();
     }
+
+    this->config->flushLog();
 }
 
 /**
- * @brief      Prints the contents of the specified queue ("wait" or "ready")
+ * @brief      Executes one instruction of the dispatched process, or the whole
+ *             fork/join region a T{fork} starts, and handles what is due 
+ *             between instructions: I/O completions, checkpoints and the stop
+ *             time.
  *
- * @param[in]  queueType  The queue type
+ * @param[in]  process  The process
+ * @param[in]  idx      The PCB table index of the process
+ * @param[in]  i        The index of the instruction in the process
+ *
+ * @return     True if the process keeps the processor, False if it now waits
+ *             for I/O or the run stopped.
  */
-void Simulation::printQueue(std::string queueType)
+bool Simulation::stepProcess(const Process &process, unsigned idx, unsigned i)
 {
-    std::cout << "\nPrinting the contents of " << queueType << "queue...\n\n";
+    const MetadataInstruction &instr = process.getInstr(i);
 
-    if (queueType == "ready")
+    if (instr.getCode() == 'T' && instr.getDescId() == DESC_FORK)
     {
-        this->printReadyQueue();
+        unsigned long cycles;
+
+        pcbTable.setPC(idx, runThreads(idx, process, i, cycles));
     }
-    else if (queueType == "wait")
+    else
     {
-        this->printWaitQueue();
+        executeInstruction(idx, instr, instr.getNumCycles());
+        pcbTable.setPC(idx, i + 1);
+    }
+
+    if (pcbTable.getState(idx) == WAIT)
+    {
+        activeIdx = NO_PROCESS;
+        lastVoluntary = true;
+        logEvent("OS: process ", pcbTable.getPID(idx), " waiting for I/O\n");
     }
+
+    deliverIOCompletions();
+    maybeCheckpoint(NULL);
+    reachedStop(NULL);
+
+    return activeIdx == idx && !stopped;
 }
 
+#if SIM_COROUTINES
 /**
- * @brief      Prints the contents of processVector
+ * @brief      Runs a process from its program counter as a coroutine. The 
+ *             coroutine suspends whenever the process waits for I/O and is 
+ *             resumed by startSimulation() once the process has been made 
+ *             ready by its interrupt and dispatched again.
+ *
+ * @param[in]  idx   The PCB table index of the process
+ *
+ * @return     The task holding the (suspended) coroutine.
  */
-void Simulation::printProcessVector()
+ProcessTask Simulation::runProcess(unsigned idx)
 {
-    std::cout << "\nPrinting the contents of processVector...\n\n";
-    for (unsigned k = 0; k < this->processVector.size(); k++)
+    const Process &process = (*processVector)[pcbTable.getPID(idx) - 1];
+
+    for (unsigned i = pcbTable.getPC(idx); i < process.getNumInstr(); i = pcbTable.getPC(idx))
     {
-        Process tempProcess = processVector[k];
+        if (!stepProcess(process, idx, i))
+        {
+            if (stopped)
+            {
+                co_return;
+            }
 
-        std::cout << tempProcess << std::endl;
+            co_await std::suspend_always();
+        }
     }
 }
-
-//
-// Free Function Implementation ////////////////////////////////////////////////
-//
+#endif
 
 /**
- * @brief      Thread that waits for a specified amount of time in milliseconds.
+ * @brief      Runs a fork/join region of a process: from a T{fork} of its main
+ *             thread to the next T{join}, or to the end of the process if 
+ *             there is none. Each T{fork} starts a thread that runs the 
+ *             instructions up to its T{exit} alongside the main thread, and 
+ *             the T{join} waits until every thread has exited. The threads 
+ *             share the process's memory. P and M instructions need one of 
+ *             the "Processor quantity" processors and wait for one in FIFO 
+ *             order while all are taken; I/O instructions only wait for their
+ *             device unit. The process keeps the processor it was dispatched
+ *             to throughout, so the scheduler sees the region as one step.
  *
- * @param      param  The duration parameter
+ * @param[in]  idx      The PCB table index of the process
+ * @param      process  The process
+ * @param[in]  fork     The index of the T{fork} that starts the region
+ * @param      cycles   The processor cycles executed by all threads
  *
- * @return     None
+ * @return     The index of the instruction after the region.
  */
-void* wait(void* param)
+unsigned Simulation::runThreads(unsigned idx, const Process &process, unsigned fork, 
+                                unsigned long &cycles)
 {
-    float duration = *((float*)param);
-    wait(duration);
-    pthread_exit(0);
-}
+    unsigned numInstr = process.getNumInstr();
+    unsigned pid = pcbTable.getPID(idx);
+    unsigned long long startUs = clock.getMicroseconds();
+    threadRegion region;
+
+    region.threads.push_back(regionThread());
+    region.join = numInstr;
+
+    // split the region into the main thread and the threads it forks
+    for (unsigned i = fork; i < numInstr && region.join == numInstr; i++)
+    {
+        const MetadataInstruction &instr = process.getInstr(i);
+
+        if (instr.getCode() == 'T' && instr.getDescId() == DESC_JOIN)
+        {
+            region.join = i;
+        }
+        else if (instr.getCode() == 'T' && instr.getDescId() == DESC_FORK)
+        {
+            regionThread thread = regionThread();
+
+            thread.fork = i;
+
+            // Metadata checked that every thread ends with a T{exit}
+            while (process.getInstr(++i).getCode() != 'T')
+            {
+                thread.items.push_back(i);
+            }
+
+            thread.items.push_back(i);
+            region.threads[0].items.push_back(THREAD_FORK | region.threads.size());
+            region.threads.push_back(thread);
+        }
+        else
+        {
+            region.threads[0].items.push_back(i);
+        }
+    }
+
+    region.freeCPUs = numCPUs;
+    region.nowUs = startUs;
+    region.workUs = 0;
+    region.cycles = 0;
+    region.slowdown = 1.0;
+    pcbTable.setState(idx, RUNNING);
+
+    if (power.getNumStates() != 0)
+    {
+        power.update(startUs);
+        region.slowdown = power.getSlowdown();
+    }
+
+    advanceThread(region, idx, process, 0);
+
+    // instructions end in time order; a thread moves on when its own ends
+    while (!region.ends.empty())
+    {
+        unsigned t = region.ends.top().second;
+        regionThread &thread = region.threads[t];
+        const MetadataInstruction &instr = process.getInstr(thread.items[thread.pos]);
+
+        region.nowUs = region.ends.top().first;
+        region.ends.pop();
+        clock.advanceTo(region.nowUs);
+
+        logThreadInstr(pid, t, instr, false, thread.memAddr);
+        stats.record(pid - 1, instr, instr.getNumCycles(), thread.waitTime, thread.unit);
+        thread.pos++;
+
+        if (thread.onCPU)
+        {
+            thread.onCPU = false;
+            region.freeCPUs++;
+
+            if (!region.cpuWaiters.empty())
+            {
+                unsigned waiter = region.cpuWaiters.front();
+
+                region.cpuWaiters.pop();
+                advanceThread(region, idx, process, waiter);
+            }
+        }
+
+        advanceThread(region, idx, process, t);
+    }
+
+    if (region.join < numInstr)
+    {
+        logThreadInstr(pid, 0, process.getInstr(region.join), false, 0);
+        stats.record(pid - 1, process.getInstr(region.join), 
+                     process.getInstr(region.join).getNumCycles(), 0.0, 0);
+    }
+
+    // the processor counts as busy for the whole region
+    if (power.getNumStates() != 0)
+    {
+        power.addBusy(region.nowUs - startUs);
+    }
+
+    stats.recordRegion(pid - 1, region.threads.size(), region.workUs, region.nowUs - startUs);
+    cycles = region.cycles;
+
+    return (region.join < numInstr) ? region.join + 1 : numInstr;
+}
+
+/**
+ * @brief      Runs a thread of a fork/join region at the region's current 
+ *             time until it starts an instruction that takes time, has to 
+ *             wait for a processor, or reaches its end. Forks, exits and A 
+ *             and S instructions take no time. The main thread starts the 
+ *             T{join} when it reaches its end.
+ *
+ * @param      region   The region
+ * @param[in]  idx      The PCB table index of the process
+ * @param      process  The process
+ * @param[in]  t        The thread (0 for the main thread)
+ */
+void Simulation::advanceThread(threadRegion &region, unsigned idx, const Process &process, 
+                               unsigned t)
+{
+    regionThread &thread = region.threads[t];
+    unsigned pid = pcbTable.getPID(idx);
+
+    while (thread.pos < thread.items.size())
+    {
+        unsigned item = thread.items[thread.pos];
+
+        if (item & THREAD_FORK)
+        {
+            unsigned child = item & ~THREAD_FORK;
+
+            logThreadInstr(pid, child, process.getInstr(region.threads[child].fork), true, 0);
+            stats.record(pid - 1, process.getInstr(region.threads[child].fork), 
+                         process.getInstr(region.threads[child].fork).getNumCycles(), 0.0, 0);
+            thread.pos++;
+            advanceThread(region, idx, process, child);
+            continue;
+        }
+
+        const MetadataInstruction &instr = process.getInstr(item);
+        char code = instr.getCode();
+        unsigned long long startUs = region.nowUs;
+
+        if (code != 'P' && code != 'M' && code != 'I' && code != 'O')
+        {
+            if (code != 'T')
+            {
+                logThreadInstr(pid, t, instr, true, 0);
+            }
+
+            logThreadInstr(pid, t, instr, false, 0);
+            stats.record(pid - 1, instr, instr.getNumCycles(), 0.0, 0);
+            thread.pos++;
+            continue;
+        }
+
+        if (code == 'P' || code == 'M')
+        {
+            if (region.freeCPUs == 0)
+            {
+                region.cpuWaiters.push(t);
+                return;
+            }
+
+            region.freeCPUs--;
+            thread.onCPU = true;
+        }
+
+        thread.unit = 0;
+        thread.memAddr = 0;
+        thread.waitTime = instr.getWaitTime();
+
+        if (instr.getDescId() == DESC_HARD_DRIVE)
+        {
+            thread.unit = countHD++ % numHD;
+        }
+        else if (instr.getDescId() == DESC_PROJECTOR)
+        {
+            thread.unit = countProj++ % numProj;
+        }
+
+        logThreadInstr(pid, t, instr, true, thread.unit);
+
+        if (code == 'P')
+        {
+            thread.waitTime *= region.slowdown;
+            region.cycles += instr.getNumCycles();
+        }
+        else if (code == 'M')
+        {
+            executeMemInstruction(instr, nextBlockPtr, memBlockSize, thread.memAddr, sysMem, 
+                                  clock, memMutex, 0.0f);
+
+            if (cache.getNumLevels() != 0)
+            {
+                thread.waitTime = accessCache(idx, instr, item, instr.getNumCycles(), 
+                                              thread.memAddr, thread.waitTime);
+            }
+        }
+        else
+        {
+            // a device unit serves its operations in issue order
+            unsigned long long &freeUs = unitFreeUs[instr.getDevice()][thread.unit];
+
+            startUs = std::max(startUs, freeUs);
+            freeUs = startUs + (unsigned long long) llround(thread.waitTime * 1000.0);
+        }
+
+        unsigned long long us = (unsigned long long) llround(thread.waitTime * 1000.0);
+
+        region.workUs += us;
+        region.ends.push(std::make_pair(startUs + us, t));
+
+        return;
+    }
+
+    if (t == 0 && region.join < process.getNumInstr())
+    {
+        logThreadInstr(pid, 0, process.getInstr(region.join), true, 0);
+    }
+}
+
+/**
+ * @brief      Sets the timeline which records every event line of the run, 
+ *             independent of the "Log" setting.
+ *
+ * @param      timeline  The timeline (NULL for none)
+ */
+void Simulation::setTimeline(Timeline *timeline)
+{
+    this->timeline = timeline;
+}
+
+/**
+ * @brief      Sets the stats file to publish live snapshots of the run to.
+ *
+ * @param      liveStats   The stats file opened with LiveStats::create() 
+ *                         (NULL for none)
+ * @param[in]  intervalUs  The simulation time between snapshots in 
+ *                         microseconds (at least 1)
+ */
+void Simulation::setLiveStats(LiveStats *liveStats, unsigned long long intervalUs)
+{
+    this->liveStats = liveStats;
+    this->liveIntervalUs = intervalUs < 1 ? 1 : intervalUs;
+}
+
+/**
+ * @brief      Publishes a snapshot of the run to the live stats file.
+ *
+ * @param[in]  finished  True if the run has ended
+ */
+void Simulation::publishLiveStats(bool finished)
+{
+    liveSnapshot snap;
+    unsigned long long now = clock.getMicroseconds();
+
+    snap.clockUs = now;
+    snap.finished = finished;
+    snap.instructions = stats.getTotalInstr();
+    snap.numProcesses = pcbTable.size();
+    snap.completed = pcbTable.getStateCount(EXIT);
+    snap.ready = pcbTable.getStateCount(READY);
+    snap.waiting = pcbTable.getStateCount(WAIT);
+    snap.memInUse = nextBlockPtr;
+    snap.sysMem = sysMem;
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        snap.busyUnits[d] = busyUnits[d];
+        snap.totalUnits[d] = (d == DEV_HARD_DRIVE) ? numHD : 
+                             (d == DEV_PROJECTOR) ? numProj : 1;
+        snap.deviceOps[d] = stats.getDeviceOps((Device) d);
+        snap.deviceTimeUs[d] = (uint64_t) (stats.getDeviceTime((Device) d) * 1000.0);
+    }
+
+    while (nextLiveUs <= now)
+    {
+        nextLiveUs += liveIntervalUs;
+    }
+
+    this->liveStats->publish(snap);
+}
+
+/**
+ * @brief      Sets the simulation time at which the run stops, keeping its 
+ *             state for forkVariants().
+ *
+ * @param[in]  stopUs  The stop time in microseconds (0 for none)
+ */
+void Simulation::setStopTime(unsigned long long stopUs)
+{
+    this->stopUs = stopUs;
+}
+
+/**
+ * @brief      Sets a checkpoint to resume the run from. The checkpoint's 
+ *             config filename must already have been read with getString().
+ *
+ * @param      ckpt  The loaded checkpoint
+ */
+void Simulation::setResumeCheckpoint(Checkpoint *ckpt)
+{
+    this->resumeCkpt = ckpt;
+}
+
+/**
+ * @brief      Gets the current simulation time.
+ *
+ * @return     The simulation time in microseconds.
+ */
+unsigned long long Simulation::getSimMicroseconds()
+{
+    return clock.getMicroseconds();
+}
+
+/**
+ * @brief      Executes a single instruction on behalf of a process, logging 
+ *             its start and end.
+ *
+ * @param[in]  idx     The PCB table index of the executing process
+ * @param      instr   The instruction to execute
+ * @param[in]  cycles  The number of cycles to execute (less than the 
+ *                     instruction's cycles for a partial P{run} slice)
+ */
+void Simulation::executeInstruction(unsigned idx, const MetadataInstruction &instr, unsigned long cycles)
+{
+    PROFILE_SCOPE(PHASE_EXECUTE);
+
+    char code = instr.getCode();
+    Descriptor descId = instr.getDescId();
+    unsigned pid = pcbTable.getPID(idx);
+    unsigned memAddr = 0;
+    bool isHD = (descId == DESC_HARD_DRIVE);
+    bool isProj = (descId == DESC_PROJECTOR);
+    unsigned unit = 0;
+    Device dev = instr.getDevice();
+    float wait_time = (instr.getNumCycles() == 0) ? 0.0f :
+        instr.getWaitTime() * cycles / instr.getNumCycles();
+    
+    if (code == 'P')
+    {
+        pcbTable.setState(idx, RUNNING);
+    }
+    else if (code == 'I' || code == 'O')
+    {
+        pcbTable.setState(idx, WAIT);
+    }
+
+    if (isHD)
+    {
+        unit = countHD++ % numHD;
+    }
+    else if (isProj)
+    {
+        unit = countProj++ % numProj;
+    }
+
+#if SIM_LOG_INSTRUCTIONS
+    if (binaryLog && this->config->logsInstructions())
+    {
+        events.instruction(clock.getMicroseconds(), instr, true, pid, unit);
+        emitEvent();
+    }
+
+    if ((textLog && this->config->logsInstructions()) || this->timeline)
+    {
+        logBuf.clear();
+        logBuf.appendTime(clock.getMicroseconds());
+        logBuf.append(" - ");
+        instr.appendLogString(logBuf, true, pid);
+
+        if (isHD || isProj)
+        {
+            logBuf.appendUInt(unit);
+        }
+
+        logBuf.append('\n');
+        emitLog(true);
+    }
+#else
+    (void) pid;
+    (void) unit;
+#endif
+
+    if (dev != DEV_NONE)
+    {
+        busyUnits[dev]++;
+    }
+
+    if (this->liveStats && clock.getMicroseconds() >= nextLiveUs)
+    {
+        publishLiveStats(false);
+    }
+
+    if (code == 'I' || code == 'O')
+    {
+        PROFILE_SCOPE(PHASE_IO_THREAD);
+
+        stats.record(pid - 1, instr, cycles, wait_time, unit);
+        issueIO(idx, instr, unit);
+
+        if (!interruptIO)
+        {
+            waitForIOCompletion();
+        }
+
+        return;
+    }
+    else if (code == 'M')
+    {
+        bool cached = (cache.getNumLevels() != 0);
+
+        // with the cache model, the time depends on the access stream, which
+        // for an allocation runs over the block just allocated
+        executeMemInstruction(instr, nextBlockPtr, memBlockSize, memAddr, sysMem, 
+                              clock, memMutex, cached ? 0.0f : wait_time);
+
+        if (cached)
+        {
+            wait_time = accessCache(idx, instr, pcbTable.getPC(idx), cycles, memAddr, wait_time);
+            clock.advance(wait_time);
+        }
+    }
+    else if (code == 'P' && power.getNumStates() != 0)
+    {
+        unsigned long long startUs = clock.getMicroseconds();
+
+        // processor cycles stretch with the P-state; the time is charged 
+        // as busy in the P-state the instruction started in
+        power.update(startUs);
+        wait_time *= power.getSlowdown();
+        clock.advance(wait_time);
+        power.addBusy(clock.getMicroseconds() - startUs);
+    }
+    else
+    {
+        clock.advance(wait_time);
+    }
+
+    logInstrEnd(pid, instr, memAddr);
+
+    if (dev != DEV_NONE)
+    {
+        busyUnits[dev]--;
+    }
+
+    stats.record(pid - 1, instr, cycles, wait_time, unit);
+}
+
+/**
+ * @brief      Logs the end line of an instruction.
+ *
+ * @param[in]  pid      The pid of the executing process
+ * @param      instr    The instruction
+ * @param[in]  memAddr  The allocated address (M{allocate} only)
+ */
+void Simulation::logInstrEnd(unsigned pid, const MetadataInstruction &instr, unsigned memAddr)
+{
+    logThreadInstr(pid, 0, instr, false, memAddr);
+}
+
+/**
+ * @brief      Logs the start or end line of an instruction of a thread.
+ *
+ * @param[in]  pid      The pid of the executing process
+ * @param[in]  thread   The thread of the process (0 for its main thread)
+ * @param      instr    The instruction
+ * @param[in]  isStart  True for the start line, False for the end line
+ * @param[in]  arg      The device unit (hard drive and projector start lines)
+ *                      or the allocated address (allocate end lines)
+ */
+void Simulation::logThreadInstr(unsigned pid, unsigned thread, const MetadataInstruction &instr, 
+                                bool isStart, unsigned long long arg)
+{
+#if SIM_LOG_INSTRUCTIONS
+    Descriptor descId = instr.getDescId();
+
+    if (binaryLog && this->config->logsInstructions())
+    {
+        events.instruction(clock.getMicroseconds(), instr, isStart, pid, arg, thread);
+        emitEvent();
+    }
+
+    if ((textLog && this->config->logsInstructions()) || this->timeline)
+    {
+        logBuf.clear();
+        logBuf.appendTime(clock.getMicroseconds());
+        logBuf.append(" - ");
+        instr.appendLogString(logBuf, isStart, pid, thread);
+
+        if (isStart && (descId == DESC_HARD_DRIVE || descId == DESC_PROJECTOR))
+        {
+            logBuf.appendUInt((unsigned) arg);
+        }
+        else if (!isStart && descId == DESC_ALLOCATE)
+        {
+            logBuf.append(' ');
+            logBuf.appendHex((unsigned) arg);
+        }
+
+        logBuf.append('\n');
+        emitLog(true);
+    }
+#else
+    (void) pid;
+    (void) thread;
+    (void) instr;
+    (void) isStart;
+    (void) arg;
+#endif
+}
+
+/**
+ * @brief      Starts an I/O operation on a device unit. The unit serves its 
+ *             operations in issue order, so the operation completes its wait
+ *             time after the later of now and the unit's previous operation.
+ *             Operations on a modelled hard drive are queued at the drive 
+ *             instead, and with coalescing they join the unit's open batch.
+ *
+ * @param[in]  idx    The PCB table index of the issuing process
+ * @param      instr  The I/O instruction
+ * @param[in]  unit   The device unit (hard drive and projector only)
+ */
+void Simulation::issueIO(unsigned idx, const MetadataInstruction &instr, unsigned unit)
+{
+    ioCompletion &rec = ioSlots[idx];
+    unsigned long long &freeUs = unitFreeUs[instr.getDevice()][unit];
+
+    rec.instr = &instr;
+    rec.idx = idx;
+    rec.unit = unit;
+    rec.costUs = interruptCostUs;
+    rec.blocking = !interruptIO;
+    rec.queued = false;
+
+    if (!disks.empty() && instr.getDevice() == DEV_HARD_DRIVE)
+    {
+        DiskScheduler &disk = disks[unit];
+        unsigned long long now = clock.getMicroseconds();
+
+        rec.queued = true;
+        disk.add(disk.makeRequest(idx, pcbTable.getPID(idx), pcbTable.getPC(idx), now,
+                                  (unsigned long long) llround(instr.getWaitTime() * 1000.0)));
+
+        if (!disk.isBusy())
+        {
+            startDisk(unit, now);
+        }
+
+        return;
+    }
+
+    if (!batchers.empty() && batchers[instr.getDevice()].getNumUnits() != 0)
+    {
+        IOBatcher &batcher = batchers[instr.getDevice()];
+        unsigned long long now = clock.getMicroseconds();
+        unsigned long long serviceUs = (unsigned long long) llround(instr.getWaitTime() * 1000.0);
+
+        rec.queued = true;
+
+        if (!batcher.add(unit, idx, instr.getCode(), serviceUs, now, freeUs))
+        {
+            sealBatch(instr.getDevice(), unit, now);
+            batcher.add(unit, idx, instr.getCode(), serviceUs, now, freeUs);
+        }
+
+        return;
+    }
+
+    rec.completeUs = std::max(clock.getMicroseconds(), freeUs) + 
+                     (unsigned long long) llround(instr.getWaitTime() * 1000.0);
+    freeUs = rec.completeUs;
+
+    postIO(rec);
+}
+
+/**
+ * @brief      Starts the next request queued at a hard drive that has become 
+ *             free and posts its completion.
+ *
+ * @param[in]  unit    The hard drive unit
+ * @param[in]  freeUs  The time the drive became free in microseconds
+ */
+void Simulation::startDisk(unsigned unit, unsigned long long freeUs)
+{
+    diskRequest req;
+    unsigned long long completeUs;
+
+    if (disks[unit].startNext(freeUs, req, completeUs))
+    {
+        ioCompletion &rec = ioSlots[req.idx];
+
+        rec.completeUs = completeUs;
+        rec.queued = false;
+        postIO(rec);
+    }
+}
+
+/**
+ * @brief      Closes the open batch of a device unit and posts the completion 
+ *             of every request in it at the time the batch completes.
+ *
+ * @param[in]  dev   The device
+ * @param[in]  unit  The device unit
+ * @param[in]  atUs  The time the batch is sealed in microseconds
+ */
+void Simulation::sealBatch(unsigned dev, unsigned unit, unsigned long long atUs)
+{
+    unsigned long long &freeUs = unitFreeUs[dev][unit];
+
+    freeUs = batchers[dev].seal(unit, atUs, freeUs, batchMembers);
+
+    for (unsigned idx: batchMembers)
+    {
+        ioCompletion &rec = ioSlots[idx];
+
+        rec.completeUs = freeUs;
+        rec.queued = false;
+        postIO(rec);
+    }
+}
+
+/**
+ * @brief      Seals the open I/O batches whose coalescing window has passed, 
+ *             or all of them when the processor is about to idle and no 
+ *             request can join them any more.
+ *
+ * @param[in]  all   True to seal every open batch now
+ */
+void Simulation::flushIOBatches(bool all)
+{
+    unsigned long long now = clock.getMicroseconds();
+
+    for (unsigned d = 0; d < batchers.size(); d++)
+    {
+        IOBatcher &batcher = batchers[d];
+
+        for (unsigned u = 0; u < batcher.getNumUnits() && batcher.getNumOpen() != 0; u++)
+        {
+            if (batcher.isOpen(u) && (all || batcher.getCloseUs(u) <= now))
+            {
+                sealBatch(d, u, all ? now : batcher.getCloseUs(u));
+            }
+        }
+    }
+}
+
+/**
+ * @brief      Hands an issued I/O operation to its device. In real time a 
+ *             detached device thread waits until the completion time and then
+ *             posts the completion record; in virtual time no wall time needs
+ *             to pass, so the record is posted at once and held back by 
+ *             deliverIOCompletions() until the clock reaches it. Coroutine 
+ *             builds queue the completion directly in both modes.
+ *
+ * @param      rec   The completion record of the operation
+ */
+void Simulation::postIO(ioCompletion &rec)
+{
+    pthread_t tid;
+    pthread_attr_t attr;
+    int err;
+
+    rec.clock = &clock;
+    rec.queue = &ioQueue;
+
+#if SIM_COROUTINES
+    // waiting processes are suspended coroutines, so no device thread is 
+    // needed: the dispatcher times the completion itself
+    ioPending.push(ioEvent(rec.completeUs, rec.idx));
+    return;
+#endif
+
+    ioInFlight++;
+
+    if (clock.isVirtual())
+    {
+        ioQueue.push(&rec);
+        return;
+    }
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    err = pthread_create(&tid, &attr, executeIOInstruction, (void*)&rec);
+    pthread_attr_destroy(&attr);
+
+    if (err != 0)
+    {
+        ioInFlight--;
+        throw std::string("Error: unable to create I/O thread");
+    }
+}
+
+/**
+ * @brief      Drains the I/O completion queue and handles the interrupt of 
+ *             every operation that has completed by now, in completion order.
+ *             Called between instructions.
+ */
+void Simulation::deliverIOCompletions()
+{
+    if (!batchers.empty())
+    {
+        flushIOBatches(false);
+    }
+
+    // handling a completion may start the next request of a drive, so the 
+    // queue is drained again before each completion
+    for (drainIOQueue(); 
+         !ioPending.empty() && ioPending.top().first <= clock.getMicroseconds();
+         drainIOQueue())
+    {
+        unsigned idx = ioPending.top().second;
+
+        ioPending.pop();
+        completeIO(idx);
+    }
+}
+
+/**
+ * @brief      Moves the completion records posted so far from the completion 
+ *             queue to the pending completion heap.
+ */
+void Simulation::drainIOQueue()
+{
+    ioCompletion *rec;
+
+    while (ioInFlight > 0 && (rec = ioQueue.pop()) != NULL)
+    {
+        ioInFlight--;
+        ioPending.push(ioEvent(rec->completeUs, rec->idx));
+    }
+}
+
+/**
+ * @brief      Idles the processor until the next I/O operation completes and 
+ *             handles its interrupt (and any others due by then).
+ *
+ * @return     False if no I/O operation is in progress, True otherwise.
+ */
+bool Simulation::waitForIOCompletion()
+{
+    ioCompletion *rec;
+
+    if (!batchers.empty())
+    {
+        flushIOBatches(true);
+    }
+
+    if (ioInFlight == 0 && ioPending.empty())
+    {
+        return false;
+    }
+
+    drainIOQueue();
+
+    // real-time device threads post when their operation is done
+    while (ioPending.empty())
+    {
+        if ((rec = ioQueue.pop()) != NULL)
+        {
+            ioInFlight--;
+            ioPending.push(ioEvent(rec->completeUs, rec->idx));
+        }
+    }
+
+    clock.advanceTo(ioPending.top().first);
+    deliverIOCompletions();
+
+    return true;
+}
+
+/**
+ * @brief      Handles the completion interrupt of a process's I/O operation:
+ *             charges the interrupt cost, logs the end of the instruction and
+ *             makes the process ready again (or running, if it kept the 
+ *             processor while it waited).
+ *
+ * @param[in]  idx   The PCB table index of the process
+ */
+void Simulation::completeIO(unsigned idx)
+{
+    const ioCompletion &rec = ioSlots[idx];
+    unsigned pid = pcbTable.getPID(idx);
+
+    // the drive moves on to its next request when this one completed
+    if (!disks.empty() && rec.instr->getDevice() == DEV_HARD_DRIVE)
+    {
+        disks[rec.unit].finish();
+        startDisk(rec.unit, rec.completeUs);
+    }
+
+    if (rec.costUs != 0)
+    {
+        clock.advance(rec.costUs / 1000.0f);
+    }
+
+    stats.recordInterrupt(rec.costUs);
+    busyUnits[rec.instr->getDevice()]--;
+    logInstrEnd(pid, *rec.instr, 0);
+
+    if (rec.blocking)
+    {
+        pcbTable.setState(idx, RUNNING);
+    }
+    else
+    {
+        pcbTable.setState(idx, READY);
+        logEvent("OS: interrupt, process ", pid, " ready\n");
+    }
+}
+
+/**
+ * @brief      Runs the address stream of a memory instruction through the 
+ *             cache hierarchy. Each cycle makes CACHE_ACCESSES_PER_CYCLE word 
+ *             accesses: an allocation touches its new block from the start, 
+ *             and other memory instructions make runs of consecutive accesses 
+ *             at random places in the blocks the process has allocated (or, 
+ *             if none, a block of its own).
+ *
+ * @param[in]  idx       The PCB table index of the process
+ * @param      instr     The memory instruction
+ * @param[in]  instrIdx  The index of the instruction in the process
+ * @param[in]  cycles    The number of cycles
+ * @param[in]  memAddr   The allocated address (M{allocate} only)
+ * @param[in]  waitTime  The time of the instruction if every access went to
+ *                       memory (ms)
+ *
+ * @return     The time of the instruction (ms).
+ */
+float Simulation::accessCache(unsigned idx, const MetadataInstruction &instr, unsigned instrIdx,
+                              unsigned long cycles, unsigned memAddr, float waitTime)
+{
+    std::vector<unsigned> &blocks = procBlocks[idx];
+    unsigned pid = pcbTable.getPID(idx);
+    unsigned long long blockBytes = (unsigned long long) memBlockSize * 1024;
+    unsigned long long accesses = (unsigned long long) cycles * CACHE_ACCESSES_PER_CYCLE;
+    unsigned long long ns = 0;
+
+    if (instr.getDescId() == DESC_ALLOCATE)
+    {
+        blocks.push_back(memAddr);
+
+        for (unsigned long long k = 0; k < accesses; k++)
+        {
+            ns += cache.access(memAddr * 1024ULL + (k * CACHE_WORD) % blockBytes);
+        }
+    }
+    else
+    {
+        unsigned long long key = ((unsigned long long) pid << 32) | instrIdx;
+
+        for (unsigned long long k = 0; k < accesses; k += CACHE_RUN_WORDS)
+        {
+            unsigned long long h = mixBits(key * 0x9e3779b97f4a7c15ULL + k);
+            unsigned long long base = blocks.empty() ? 
+                ((pid - 1) * blockBytes) % ((unsigned long long) sysMem * 1024) :
+                blocks[h % blocks.size()] * 1024ULL;
+            unsigned long long offset = ((h >> 24) % (blockBytes / CACHE_WORD)) * CACHE_WORD;
+
+            for (unsigned j = 0; j < CACHE_RUN_WORDS && k + j < accesses; j++)
+            {
+                ns += cache.access(base + (offset + j * CACHE_WORD) % blockBytes);
+            }
+        }
+    }
+
+    if (accesses == 0)
+    {
+        return 0.0f;
+    }
+
+    return (float) (waitTime * ns / ((double) accesses * CACHE_MEMORY_NS));
+}
+
+/**
+ * @brief      Charges the cost of dispatching a process: the dispatch cost 
+ *             every time, and the state save/restore cost and cache refill 
+ *             penalty if a different process ran last. The switch is counted
+ *             against the process that left the processor, as voluntary if it
+ *             left to wait for I/O.
+ *
+ * @param[in]  idx   The PCB table index of the dispatched process
+ */
+void Simulation::dispatchProcess(unsigned idx)
+{
+    bool switched = (idx != lastIdx);
+
+    if (switched && lastIdx != NO_PROCESS && pcbTable.getState(lastIdx) != EXIT)
+    {
+        pcbTable.countSwitch(lastIdx, lastVoluntary);
+    }
+
+    stats.recordDispatch(switched, dispatchCostUs, switchCostUs, refillCostUs);
+
+    if (dispatchCostUs != 0 || (switched && (switchCostUs != 0 || refillCostUs != 0)))
+    {
+        clock.advance((dispatchCostUs + (switched ? switchCostUs + refillCostUs : 0)) / 1000.0f);
+    }
+
+    lastIdx = idx;
+}
+
+/**
+ * @brief      Logs a timestamped event line.
+ *
+ * @param[in]  msg   The message (including trailing newline)
+ */
+void Simulation::logEvent(const char *msg)
+{
+    if (binaryLog)
+    {
+        events.message(clock.getMicroseconds(), msg);
+        emitEvent();
+    }
+
+    if (!textLog && !this->timeline)
+    {
+        return;
+    }
+
+    logBuf.clear();
+    logBuf.appendTime(clock.getMicroseconds());
+    logBuf.append(" - ");
+    logBuf.append(msg);
+    emitLog(false);
+}
+
+/**
+ * @brief      Logs a timestamped event line about a process.
+ *
+ * @param[in]  prefix  The message text before the pid
+ * @param[in]  pid     The pid
+ * @param[in]  suffix  The message text after the pid (including newline)
+ */
+void Simulation::logEvent(const char *prefix, unsigned pid, const char *suffix)
+{
+    if (binaryLog)
+    {
+        events.message(clock.getMicroseconds(), prefix, pid, suffix);
+        emitEvent();
+    }
+
+    if (!textLog && !this->timeline)
+    {
+        return;
+    }
+
+    logBuf.clear();
+    logBuf.appendTime(clock.getMicroseconds());
+    logBuf.append(" - ");
+    logBuf.append(prefix);
+    logBuf.appendUInt(pid);
+    logBuf.append(suffix);
+    emitLog(false);
+}
+
+/**
+ * @brief      Emits the line in the log buffer to the log and the timeline. 
+ *             Process-level lines are logged unless the run is summary-only;
+ *             instruction lines only if "Log Level" allows them.
+ *
+ * @param[in]  isInstrLine  True if the line is an instruction start/end line
+ */
+void Simulation::emitLog(bool isInstrLine)
+{
+    PROFILE_SCOPE(PHASE_LOG);
+
+    if (textLog && (!isInstrLine || this->config->logsInstructions()))
+    {
+        this->config->logData(logBuf.data(), logBuf.size());
+    }
+
+    if (this->timeline)
+    {
+        this->timeline->record(logBuf.data(), logBuf.size());
+    }
+}
+
+/**
+ * @brief      Emits the records encoded by the last call to the event log 
+ *             encoder to the binary log file.
+ */
+void Simulation::emitEvent()
+{
+    PROFILE_SCOPE(PHASE_LOG);
+
+    this->config->logBinary(events.data(), events.size());
+}
+
+/**
+ * @brief      Logs a block of text, such as an end-of-run report, to the 
+ *             text logs and as a text record to the binary log file.
+ *
+ * @param[in]  data  The text
+ */
+void Simulation::logText(const std::string &data)
+{
+    this->config->logData(data);
+
+    if (binaryLog)
+    {
+        events.text(data);
+        emitEvent();
+    }
+}
+
+/**
+ * @brief      Runs all processes in readyQueue under proportional-share 
+ *             scheduling (STRIDE or LOTTERY). Each dispatch runs a process for 
+ *             at most "Processor Quantum Number" processor cycles, splitting 
+ *             P{run} instructions across quanta where needed.
+ *
+ * @param[in]  algo  The scheduling algorithm (STRIDE or LOTTERY)
+ */
+void Simulation::runProportionalShare(std::string algo)
+{
+    unsigned long quantum = strToUnsignedLong(this->config->getSettingVal("Processor Quantum Number"));
+
+    if (quantum == 0)
+    {
+        throw std::string("Error: 'Processor Quantum Number' missing from config file");
+    }
+
+    ShareScheduler scheduler(algo == "LOTTERY", LOTTERY_SEED);
+    unsigned idx;
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        scheduler.addProcess(k, pcbTable.getTickets(k));
+    }
+
+    this->shareCycles.assign(pcbTable.size(), 0);
+    this->shareTickets.assign(pcbTable.size(), 0);
+    this->sharePIDs.assign(pcbTable.size(), 0);
+    this->shareWindowCycles.clear();
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        this->shareTickets[k] = scheduler.getTickets(k);
+        this->sharePIDs[k] = pcbTable.getPID(k);
+    }
+
+    if (this->resumeCkpt)
+    {
+        this->shareWindowOpen = this->resumeCkpt->getUInt() != 0;
+
+        for (unsigned long long &cycles: this->shareCycles)
+        {
+            cycles = this->resumeCkpt->getUInt();
+        }
+
+        this->shareWindowCycles.resize(this->resumeCkpt->getUInt());
+
+        for (unsigned long long &cycles: this->shareWindowCycles)
+        {
+            cycles = this->resumeCkpt->getUInt();
+        }
+
+        scheduler.restore(*this->resumeCkpt);
+        this->resumeCkpt = NULL;
+    }
+
+    while (scheduler.pickNext(idx))
+    {
+        unsigned pid = pcbTable.getPID(idx);
+        const Process &process = (*processVector)[pid-1];
+        unsigned numInstr = pcbTable.getNumInstr(idx);
+        unsigned long cyclesUsed = 0;
+
+        if (pcbTable.getPC(idx) == 0 && pcbTable.getRemCycles(idx) == 0)
+        {
+            logEvent("OS: preparing process ", pid, "\n");
+        }
+
+        pcbTable.setState(idx, RUNNING);
+        logEvent("OS: starting process ", pid, "\n");
+        dispatchProcess(idx);
+
+        while (pcbTable.getPC(idx) < numInstr && cyclesUsed < quantum)
+        {
+            const MetadataInstruction &instr = process.getInstr(pcbTable.getPC(idx));
+
+            // a fork/join region runs to its end within the dispatch
+            if (instr.getCode() == 'T' && instr.getDescId() == DESC_FORK)
+            {
+                unsigned long cycles;
+
+                pcbTable.setPC(idx, runThreads(idx, process, pcbTable.getPC(idx), cycles));
+                cyclesUsed += cycles;
+                continue;
+            }
+
+            if (instr.getCode() == 'P')
+            {
+                unsigned long remCycles = pcbTable.getRemCycles(idx);
+                unsigned long slice;
+
+                if (remCycles == 0)
+                {
+                    remCycles = instr.getNumCycles();
+                }
+
+                slice = std::min(remCycles, quantum - cyclesUsed);
+
+                executeInstruction(idx, instr, slice);
+
+                cyclesUsed += slice;
+                remCycles -= slice;
+                pcbTable.setRemCycles(idx, remCycles);
+
+                if (remCycles > 0)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                executeInstruction(idx, instr, instr.getNumCycles());
+            }
+
+            pcbTable.setPC(idx, pcbTable.getPC(idx) + 1);
+        }
+
+        this->shareCycles[idx] += cyclesUsed;
+
+        if (pcbTable.getPC(idx) < numInstr)
+        {
+            pcbTable.setState(idx, READY);
+            scheduler.requeue(idx, cyclesUsed);
+            lastVoluntary = false;
+
+            logEvent("OS: process ", pid, " quantum expired\n");
+        }
+        else
+        {
+            pcbTable.setState(idx, EXIT);
+            procEndUs[idx] = clock.getMicroseconds();
+
+            // the contention window closes when the first process finishes
+            if (this->shareWindowOpen)
+            {
+                this->shareWindowCycles = this->shareCycles;
+                this->shareWindowOpen = false;
+            }
+
+            logEvent("End process ", pid, "\n");
+        }
+
+        maybeCheckpoint(&scheduler);
+
+        if (reachedStop(&scheduler))
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief      Logs the achieved versus target CPU share of every process for 
+ *             the last proportional-share run. Achieved shares are measured 
+ *             over the contention window, i.e. until the first process 
+ *             finished, during which all processes were competing.
+ *
+ * @param[in]  algo  The scheduling algorithm (STRIDE or LOTTERY)
+ */
+void Simulation::logShareReport(std::string algo)
+{
+    unsigned long long totalTickets = 0, windowCycles = 0;
+    double sumErr = 0.0, maxErr = 0.0;
+    std::ostringstream out;
+    std::string data;
+
+    for (unsigned k = 0; k < this->shareTickets.size(); k++)
+    {
+        totalTickets += this->shareTickets[k];
+        windowCycles += this->shareWindowCycles[k];
+    }
+
+    out << std::setprecision(2) << std::fixed;
+    out << "Proportional-share report (" << algo << ", " << windowCycles
+        << " cycles in contention window)\n";
+    out << std::setw(8) << "PID" << std::setw(10) << "Tickets" 
+        << std::setw(10) << "Target" << std::setw(10) << "Achieved" 
+        << std::setw(12) << "Cycles" << "\n";
+
+    for (unsigned k = 0; k < this->shareTickets.size(); k++)
+    {
+        double target = 100.0 * this->shareTickets[k] / totalTickets;
+        double achieved = (windowCycles == 0) ? 0.0 :
+            100.0 * this->shareWindowCycles[k] / windowCycles;
+        double err = achieved > target ? achieved - target : target - achieved;
+
+        sumErr += err;
+        maxErr = std::max(maxErr, err);
+
+        out << std::setw(8) << this->sharePIDs[k] 
+            << std::setw(10) << this->shareTickets[k]
+            << std::setw(9) << target << "%" 
+            << std::setw(9) << achieved << "%" 
+            << std::setw(12) << this->shareCycles[k] << "\n";
+    }
+
+    if (!this->shareTickets.empty())
+    {
+        out << "Share error: mean " << sumErr / this->shareTickets.size() 
+            << "%, max " << maxErr << "%\n";
+    }
+
+    out << "\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the results of the power model: the time, busy time and 
+ *             energy of each P-state, the number of P-state transitions, and
+ *             the total energy, average power and energy-delay product of the
+ *             run.
+ */
+void Simulation::logPowerReport()
+{
+    std::ostringstream out;
+    std::string data;
+    double seconds = clock.getMicroseconds() / 1000000.0;
+    double energyJ = power.getEnergy();
+
+    out << std::setprecision(3) << std::fixed;
+    out << "Power report (" << GOVERNOR_NAMES[power.getGovernor()] << " governor, " 
+        << power.getSampleUs() / 1000.0 << " ms samples)\n";
+    out << std::setw(8) << "MHz" << std::setw(8) << "Volts" 
+        << std::setw(16) << "Time (ms)" << std::setw(16) << "Busy (ms)" 
+        << std::setw(14) << "Energy (J)" << "\n";
+
+    for (unsigned k = power.getNumStates(); k-- > 0; )
+    {
+        const pState &state = power.getState(k);
+
+        out << std::setw(8) << state.mhz << std::setw(8) << std::setprecision(2) << state.volts 
+            << std::setprecision(3) << std::setw(16) << state.residencyUs / 1000.0 
+            << std::setw(16) << state.busyUs / 1000.0 << std::setw(14) << state.energyJ << "\n";
+    }
+
+    out << "P-state transitions: " << power.getTransitions() << "\n";
+    out << "Total energy: " << energyJ << " J, average power: " 
+        << (seconds > 0.0 ? energyJ / seconds : 0.0) << " W, energy-delay product: " 
+        << energyJ * seconds << " J*s\n\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the results of each tenant: its weight, processes, 
+ *             instructions executed, time spent executing them and on the 
+ *             processor, its share of all processor time, and the mean 
+ *             turnaround and last completion time of its processes.
+ */
+void Simulation::logTenantReport()
+{
+    unsigned numTenants = this->tenants.size();
+    std::vector<unsigned> procs(numTenants, 0);
+    std::vector<unsigned long long> instr(numTenants, 0), turnaroundUs(numTenants, 0), 
+                                    lastUs(numTenants, 0);
+    std::vector<double> time(numTenants, 0.0), cpuTime(numTenants, 0.0);
+    double totalCpuTime = 0.0;
+    std::ostringstream out;
+    std::string data;
+
+    for (unsigned k = 0; k < this->processVector->size(); k++)
+    {
+        unsigned t = (*this->processVector)[k].getTenant();
+
+        procs[t]++;
+        instr[t] += stats.getProcInstr(k);
+        time[t] += stats.getProcTime(k);
+        cpuTime[t] += stats.getProcCpuTime(k);
+        turnaroundUs[t] += procEndUs[k];
+        lastUs[t] = std::max(lastUs[t], procEndUs[k]);
+        totalCpuTime += stats.getProcCpuTime(k);
+    }
+
+    out << std::setprecision(2) << std::fixed;
+    out << "Tenant report (" << numTenants << " tenants)\n";
+    out << std::setw(8) << "Tenant" << std::setw(8) << "Weight" 
+        << std::setw(8) << "Procs" << std::setw(12) << "Instr" 
+        << std::setw(14) << "Time (ms)" << std::setw(14) << "CPU (ms)" 
+        << std::setw(11) << "CPU share" << std::setw(18) << "Turnaround (ms)" 
+        << std::setw(16) << "Finished (ms)" << "\n";
+
+    for (unsigned t = 0; t < numTenants; t++)
+    {
+        out << std::setw(8) << t + 1 << std::setw(8) << this->tenantWeights[t] 
+            << std::setw(8) << procs[t] << std::setw(12) << instr[t] 
+            << std::setw(14) << time[t] << std::setw(14) << cpuTime[t] 
+            << std::setw(10) << (totalCpuTime == 0.0 ? 0.0 : 100.0 * cpuTime[t] / totalCpuTime) << "%"
+            << std::setw(18) << (procs[t] == 0 ? 0.0 : turnaroundUs[t] / 1000.0 / procs[t]) 
+            << std::setw(16) << lastUs[t] / 1000.0 << "\n";
+    }
+
+    for (unsigned t = 0; t < numTenants; t++)
+    {
+        out << "Tenant " << t + 1 << ": " << this->tenants[t]->getFilename() << "\n";
+    }
+
+    out << "\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the fork/join regions of each process that ran any: the 
+ *             most threads it ran at once, its regions, the time the 
+ *             instructions of all threads took (work) and from fork to join 
+ *             (elapsed), its speedup (work over elapsed) and its parallel 
+ *             efficiency (speedup per processor). I/O overlapping the 
+ *             processors counts as work, so efficiency can exceed 100%.
+ */
+void Simulation::logThreadReport()
+{
+    unsigned long long totalWorkUs = 0, totalSpanUs = 0;
+    std::ostringstream out;
+    std::string data;
+
+    out << std::setprecision(2) << std::fixed;
+    out << "Thread report (" << numCPUs << (numCPUs == 1 ? " processor" : " processors") 
+        << ")\n";
+    out << std::setw(8) << "PID" << std::setw(10) << "Threads" 
+        << std::setw(10) << "Regions" << std::setw(14) << "Work (ms)" 
+        << std::setw(16) << "Elapsed (ms)" << std::setw(10) << "Speedup" 
+        << std::setw(12) << "Efficiency" << "\n";
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        unsigned long long workUs = stats.getProcWorkUs(k);
+        unsigned long long spanUs = stats.getProcSpanUs(k);
+        double speedup = (spanUs == 0) ? 1.0 : (double) workUs / spanUs;
+
+        if (stats.getProcRegions(k) == 0)
+        {
+            continue;
+        }
+
+        totalWorkUs += workUs;
+        totalSpanUs += spanUs;
+
+        out << std::setw(8) << k + 1 << std::setw(10) << stats.getProcThreads(k) 
+            << std::setw(10) << stats.getProcRegions(k) 
+            << std::setw(14) << workUs / 1000.0 << std::setw(16) << spanUs / 1000.0 
+            << std::setw(10) << speedup 
+            << std::setw(11) << 100.0 * speedup / numCPUs << "%\n";
+    }
+
+    double speedup = (totalSpanUs == 0) ? 1.0 : (double) totalWorkUs / totalSpanUs;
+
+    out << "Overall speedup: " << speedup << ", parallel efficiency: " 
+        << 100.0 * speedup / numCPUs << "%\n\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the per-drive results of the hard drive model: requests 
+ *             served, and mean head travel, seek time, rotational latency and
+ *             response time (issue to completion) per request.
+ */
+void Simulation::logDiskReport()
+{
+    std::ostringstream out;
+    std::string data;
+
+    out << std::setprecision(3) << std::fixed;
+    out << "Disk report (" << this->config->getSettingVal("Disk Scheduling Code") 
+        << ")\n";
+    out << std::setw(8) << "Drive" << std::setw(10) << "Requests" 
+        << std::setw(12) << "Seek (cyl)" << std::setw(12) << "Seek (ms)" 
+        << std::setw(12) << "Rot (ms)" << std::setw(14) << "Response (ms)" 
+        << std::setw(11) << "Max queue" << "\n";
+
+    for (unsigned u = 0; u < disks.size(); u++)
+    {
+        const DiskScheduler &disk = disks[u];
+        double n = disk.getRequests() ? (double) disk.getRequests() : 1.0;
+
+        out << std::setw(8) << u 
+            << std::setw(10) << disk.getRequests()
+            << std::setw(12) << disk.getSeekDistance() / n
+            << std::setw(12) << disk.getSeekUs() / n / 1000.0
+            << std::setw(12) << disk.getRotationUs() / n / 1000.0
+            << std::setw(14) << disk.getResponseUs() / n / 1000.0
+            << std::setw(11) << disk.getMaxQueue() << "\n";
+    }
+
+    out << "\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the results of I/O coalescing per device: requests served,
+ *             batches, mean and largest batch size and the service time saved
+ *             by serving each batch as one operation.
+ */
+void Simulation::logCoalesceReport()
+{
+    std::ostringstream out;
+    std::string data;
+
+    out << std::setprecision(3) << std::fixed;
+    out << "I/O coalescing report (window " << coalesceUs << " us)\n";
+    out << std::left << std::setw(12) << "Device" << std::right 
+        << std::setw(10) << "Requests" << std::setw(10) << "Batches" 
+        << std::setw(12) << "Mean size" << std::setw(10) << "Max size" 
+        << std::setw(12) << "Saved (ms)" << "\n";
+
+    for (unsigned d = 0; d < batchers.size(); d++)
+    {
+        const IOBatcher &batcher = batchers[d];
+
+        if (batcher.getRequests() == 0)
+        {
+            continue;
+        }
+
+        out << std::left << std::setw(12) << DEVICE_NAMES[d] << std::right 
+            << std::setw(10) << batcher.getRequests()
+            << std::setw(10) << batcher.getBatches()
+            << std::setw(12) << (double) batcher.getRequests() / batcher.getBatches()
+            << std::setw(10) << batcher.getMaxBatch()
+            << std::setw(12) << batcher.getSavedUs() / 1000.0 << "\n";
+    }
+
+    out << "\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the results of the cache model: accesses, hits and hit 
+ *             rate per level, accesses that went to memory, and the mean 
+ *             access latency.
+ */
+void Simulation::logCacheReport()
+{
+    std::ostringstream out;
+    std::string data;
+    unsigned long long total = 0;
+
+    out << std::setprecision(3) << std::fixed;
+    out << "Cache report (" << CACHE_POLICY_NAMES[cache.getPolicy()] << ", " 
+        << cache.getLineSize() << "-byte lines)\n";
+    out << std::left << std::setw(8) << "Level" << std::right 
+        << std::setw(12) << "Size (KB)" << std::setw(6) << "Ways" 
+        << std::setw(14) << "Accesses" << std::setw(14) << "Hits" 
+        << std::setw(12) << "Hit rate" << "\n";
+
+    for (unsigned l = 0; l < cache.getNumLevels(); l++)
+    {
+        const cacheLevel &level = cache.getLevel(l);
+
+        out << std::left << std::setw(8) << level.name << std::right 
+            << std::setw(12) << level.sizeKB << std::setw(6) << level.ways
+            << std::setw(14) << level.accesses << std::setw(14) << level.hits
+            << std::setw(11) << (level.accesses ? 100.0 * level.hits / level.accesses : 0.0) 
+            << "%\n";
+    }
+
+    total = cache.getLevel(0).accesses;
+    out << "Memory accesses: " << cache.getMemoryAccesses() << ", mean latency: " 
+        << (total ? (double) cache.getTotalNs() / total : 0.0) << " ns (" 
+        << (total ? 100.0 * cache.getTotalNs() / ((double) total * CACHE_MEMORY_NS) : 0.0) 
+        << "% of uncached)\n\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Logs the dispatches and context switches of the run, the time 
+ *             they cost and the switches of every process.
+ *
+ * @param[in]  algo  The scheduling algorithm
+ */
+void Simulation::logSwitchReport(std::string algo)
+{
+    std::ostringstream out;
+    std::string data;
+    unsigned long long lostUs = stats.getDispatchUs() + stats.getSwitchUs() + 
+                                stats.getRefillUs();
+    unsigned long long endUs = clock.getMicroseconds();
+    unsigned long long voluntary = 0, preempted = 0;
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        voluntary += pcbTable.getVoluntarySwitches(k);
+        preempted += pcbTable.getInvoluntarySwitches(k);
+    }
+
+    out << std::setprecision(3) << std::fixed;
+    out << "Context switch report (" << algo << ")\n";
+    out << "Dispatches: " << stats.getDispatches() << ", switches: " 
+        << stats.getSwitches() << " (voluntary " << voluntary 
+        << ", involuntary " << preempted << ")\n";
+    out << "Dispatch: " << stats.getDispatchUs() / 1000.0 << " ms, state switch: " 
+        << stats.getSwitchUs() / 1000.0 << " ms, cache refill: " 
+        << stats.getRefillUs() / 1000.0 << " ms\n";
+    out << "Total lost: " << lostUs / 1000.0 << " ms (" 
+        << (endUs ? 100.0 * lostUs / endUs : 0.0) << "% of the run)\n";
+    out << std::setw(8) << "PID" << std::setw(12) << "Voluntary" 
+        << std::setw(14) << "Involuntary" << "\n";
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        out << std::setw(8) << pcbTable.getPID(k) 
+            << std::setw(12) << pcbTable.getVoluntarySwitches(k)
+            << std::setw(14) << pcbTable.getInvoluntarySwitches(k) << "\n";
+    }
+
+    out << "\n";
+
+    data = out.str();
+    logText(data);
+}
+
+/**
+ * @brief      Saves a checkpoint if the checkpoint interval has elapsed since 
+ *             the last one. Called only between instructions, when no device 
+ *             or memory operation is in progress.
+ *
+ * @param[in]  scheduler  The proportional-share scheduler (NULL if unused)
+ */
+void Simulation::maybeCheckpoint(const ShareScheduler *scheduler)
+{
+    unsigned long long now;
+
+    if (ckptIntervalUs == 0)
+    {
+        return;
+    }
+
+    now = clock.getMicroseconds();
+
+    if (now < nextCkptUs)
+    {
+        return;
+    }
+
+    while (nextCkptUs <= now)
+    {
+        nextCkptUs += ckptIntervalUs;
+    }
+
+    saveCheckpoint(scheduler);
+}
+
+/**
+ * @brief      Writes the full simulation state to the checkpoint file.
+ *
+ * @param[in]  scheduler  The proportional-share scheduler (NULL if unused)
+ */
+void Simulation::saveCheckpoint(const ShareScheduler *scheduler)
+{
+    PROFILE_SCOPE(PHASE_CHECKPOINT);
+
+    Checkpoint ckpt;
+
+    writeCheckpoint(ckpt, scheduler);
+    ckpt.save(ckptFilename);
+}
+
+/**
+ * @brief      Appends the full simulation state to a checkpoint: clock, device
+ *             and memory state, log position, PCBs, statistics and 
+ *             proportional-share scheduler state.
+ *
+ * @param      ckpt       The checkpoint
+ * @param[in]  scheduler  The proportional-share scheduler (NULL if unused)
+ */
+void Simulation::writeCheckpoint(Checkpoint &ckpt, const ShareScheduler *scheduler)
+{
+    ckpt.putString(this->configFilename);
+    ckpt.putUInt(this->tenants.size());
+
+    for (const std::shared_ptr<Metadata> &tenant: this->tenants)
+    {
+        ckpt.putUInt(tenant->getInstrArena().size());
+    }
+
+    ckpt.putString(this->config->getSettingVal("CPU Scheduling Code"));
+    ckpt.putUInt(clock.getMicroseconds());
+    ckpt.putUInt(nextCkptUs);
+    ckpt.putUInt(countHD);
+    ckpt.putUInt(countProj);
+    ckpt.putUInt(nextBlockPtr);
+    ckpt.putUInt(this->config->getLogPosition());
+    ckpt.putUInt(activeIdx + 1);
+    ckpt.putUInt(lastIdx + 1);
+    ckpt.putUInt(lastVoluntary);
+    ckpt.putUInt(pcbTable.size());
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        ckpt.putUInt(pcbTable.getPC(k));
+        ckpt.putUInt(pcbTable.getState(k));
+        ckpt.putUInt(pcbTable.getRemCycles(k));
+        ckpt.putUInt(procEndUs[k]);
+        ckpt.putUInt(pcbTable.getVoluntarySwitches(k));
+        ckpt.putUInt(pcbTable.getInvoluntarySwitches(k));
+
+        // I/O in flight, which only interrupt-driven I/O leaves at this point
+        if (pcbTable.getState(k) == WAIT)
+        {
+            ckpt.putUInt(ioSlots[k].completeUs);
+            ckpt.putUInt(ioSlots[k].unit);
+            ckpt.putUInt(ioSlots[k].queued);
+        }
+    }
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        ckpt.putUInt(unitFreeUs[d].size());
+
+        for (unsigned long long freeUs: unitFreeUs[d])
+        {
+            ckpt.putUInt(freeUs);
+        }
+    }
+
+    ckpt.putUInt(disks.size());
+
+    for (const DiskScheduler &disk: disks)
+    {
+        disk.save(ckpt);
+    }
+
+    ckpt.putUInt(batchers.size());
+
+    for (const IOBatcher &batcher: batchers)
+    {
+        batcher.save(ckpt);
+    }
+
+    cache.save(ckpt);
+    power.save(ckpt);
+
+    for (const std::vector<unsigned> &blocks: procBlocks)
+    {
+        ckpt.putUInt(blocks.size());
+
+        for (unsigned addr: blocks)
+        {
+            ckpt.putUInt(addr);
+        }
+    }
+
+    stats.save(ckpt);
+
+    if (scheduler)
+    {
+        ckpt.putUInt(this->shareWindowOpen);
+
+        for (unsigned long long cycles: this->shareCycles)
+        {
+            ckpt.putUInt(cycles);
+        }
+
+        ckpt.putUInt(this->shareWindowCycles.size());
+
+        for (unsigned long long cycles: this->shareWindowCycles)
+        {
+            ckpt.putUInt(cycles);
+        }
+
+        scheduler->save(ckpt);
+    }
+}
+
+/**
+ * @brief      Restores the simulation state saved by saveCheckpoint() over 
+ *             the freshly created processes and restarts the clock at the 
+ *             checkpoint time. Proportional-share state is restored by 
+ *             runProportionalShare().
+ */
+void Simulation::restoreCheckpoint()
+{
+    Checkpoint &ckpt = *this->resumeCkpt;
+    std::string code = this->config->getSettingVal("CPU Scheduling Code");
+    std::string ckptCode;
+    unsigned long long startUs, logPosition;
+    unsigned voluntary;
+
+    if (ckpt.getUInt() != this->tenants.size())
+    {
+        throw std::string("Error: checkpoint does not match metadata");
+    }
+
+    for (const std::shared_ptr<Metadata> &tenant: this->tenants)
+    {
+        if (ckpt.getUInt() != tenant->getInstrArena().size())
+        {
+            throw std::string("Error: checkpoint does not match metadata");
+        }
+    }
+
+    // FIFO, PS and SJF keep no scheduler state, so they may be switched
+    ckptCode = ckpt.getString();
+
+    if (ckptCode != code && 
+        (code == "STRIDE" || code == "LOTTERY" || 
+         ckptCode == "STRIDE" || ckptCode == "LOTTERY"))
+    {
+        throw std::string("Error: checkpoint does not match configuration");
+    }
+
+    startUs      = ckpt.getUInt();
+    nextCkptUs   = ckpt.getUInt();
+    countHD      = (unsigned) ckpt.getUInt();
+    countProj    = (unsigned) ckpt.getUInt();
+    nextBlockPtr = (unsigned) ckpt.getUInt();
+    logPosition  = ckpt.getUInt();
+
+    // a variant with less "System memory" wraps its allocator back to the start
+    if (nextBlockPtr >= sysMem)
+    {
+        nextBlockPtr = 0;
+    }
+
+    activeIdx    = (unsigned) ckpt.getUInt() - 1;
+    lastIdx      = (unsigned) ckpt.getUInt() - 1;
+    lastVoluntary = ckpt.getUInt() != 0;
+
+    if (ckpt.getUInt() != pcbTable.size())
+    {
+        throw std::string("Error: checkpoint does not match metadata");
+    }
+
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        pcbTable.setPC(k, (unsigned) ckpt.getUInt());
+        pcbTable.setState(k, (State) ckpt.getUInt());
+        pcbTable.setRemCycles(k, (unsigned long) ckpt.getUInt());
+        procEndUs[k] = ckpt.getUInt();
+        voluntary    = (unsigned) ckpt.getUInt();
+        pcbTable.setSwitches(k, voluntary, (unsigned) ckpt.getUInt());
+
+        if (pcbTable.getState(k) == WAIT)
+        {
+            ioSlots[k].completeUs = ckpt.getUInt();
+            ioSlots[k].unit = (unsigned) ckpt.getUInt();
+            ioSlots[k].queued = ckpt.getUInt() != 0;
+        }
+    }
+
+    // variants may have a different number of device units
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        unsigned long long size = ckpt.getUInt();
+
+        for (unsigned long long u = 0; u < size; u++)
+        {
+            unsigned long long freeUs = ckpt.getUInt();
+
+            if (u < unitFreeUs[d].size())
+            {
+                unitFreeUs[d][u] = freeUs;
+            }
+        }
+    }
+
+    // queued requests belong to their drive, so the drives must match
+    if (ckpt.getUInt() != disks.size())
+    {
+        throw std::string("Error: checkpoint does not match configuration");
+    }
+
+    for (DiskScheduler &disk: disks)
+    {
+        disk.restore(ckpt);
+    }
+
+    if (ckpt.getUInt() != batchers.size())
+    {
+        throw std::string("Error: checkpoint does not match configuration");
+    }
+
+    for (IOBatcher &batcher: batchers)
+    {
+        batcher.restore(ckpt);
+    }
+
+    cache.restore(ckpt);
+    power.restore(ckpt);
+
+    for (std::vector<unsigned> &blocks: procBlocks)
+    {
+        blocks.resize(ckpt.getUInt());
+
+        for (unsigned &addr: blocks)
+        {
+            addr = (unsigned) ckpt.getUInt();
+        }
+    }
+
+    stats.restore(ckpt);
+
+    if (!isVariant)
+    {
+        this->config->resumeLog(logPosition);
+    }
+
+    clock.start(this->config->usesVirtualClock(), startUs);
+
+    // reissue I/O that was in flight
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        if (pcbTable.getState(k) == WAIT)
+        {
+            ioCompletion &rec = ioSlots[k];
+
+            rec.instr = &(*processVector)[pcbTable.getPID(k) - 1].getInstr(pcbTable.getPC(k) - 1);
+            rec.idx = k;
+            rec.costUs = interruptCostUs;
+            rec.blocking = false;
+            busyUnits[rec.instr->getDevice()]++;
+
+            if (!rec.queued)
+            {
+                postIO(rec);
+            }
+        }
+    }
+
+    if (ckpt.atEnd())
+    {
+        this->resumeCkpt = NULL;
+    }
+}
 
 /**
- * @brief      Non-threaded version of wait() - waits for a specified amount of
- *             time in milliseconds.
+ * @brief      Stops the run at a safe point once the stop time set with 
+ *             setStopTime() is reached, keeping the state in memory for 
+ *             forkVariants().
  *
- * @param      duration  The duration to wait for
+ * @param[in]  scheduler  The proportional-share scheduler (NULL if unused)
  *
- * @return     None
+ * @return     True if the run stopped, False otherwise.
+ */
+bool Simulation::reachedStop(const ShareScheduler *scheduler)
+{
+    if (stopUs == 0 || clock.getMicroseconds() < stopUs)
+    {
+        return false;
+    }
+
+    forkCkpt.clear();
+    writeCheckpoint(forkCkpt, scheduler);
+    stopped = true;
+    stopUs = clock.getMicroseconds();     // where the run actually stopped
+
+    return true;
+}
+
+/**
+ * @brief      Runs what-if variants of a run stopped with setStopTime() in 
+ *             parallel threads, plus the unchanged continuation as a baseline,
+ *             and logs their results side by side.
+ *
+ * @param[in]  specs  The overrides of each variant (see the variant 
+ *                    constructor)
+ */
+void Simulation::forkVariants(const std::vector<std::string> &specs)
+{
+    std::vector<std::string> names(1, "baseline");
+    std::vector<Simulation*> sims;
+    std::vector<variantRun> runs;
+    std::vector<pthread_t> tids;
+    std::vector<bool> started;
+    std::string error;
+
+    if (!stopped)
+    {
+        throw std::string("Error: cannot fork variants - simulation ended before fork time");
+    }
+
+    names.insert(names.end(), specs.begin(), specs.end());
+
+    try
+    {
+        for (const std::string &name: names)
+        {
+            sims.push_back(new Simulation(*this, name == "baseline" ? "" : name));
+        }
+    }
+    catch (std::string &e)
+    {
+        for (Simulation *sim: sims)
+        {
+            delete sim;
+        }
+
+        throw;
+    }
+
+    runs.resize(sims.size());
+    tids.resize(sims.size());
+    started.resize(sims.size());
+
+    for (unsigned k = 0; k < sims.size(); k++)
+    {
+        runs[k].sim = sims[k];
+        started[k] = (pthread_create(&tids[k], NULL, runVariantThread, 
+                                     (void*)&runs[k]) == 0);
+
+        // without a thread of its own, the variant runs right here
+        if (!started[k])
+        {
+            runVariantThread(&runs[k]);
+        }
+    }
+
+    for (unsigned k = 0; k < sims.size(); k++)
+    {
+        if (started[k])
+        {
+            pthread_join(tids[k], NULL);
+        }
+
+        if (error.empty() && !runs[k].error.empty())
+        {
+            error = runs[k].error;
+        }
+    }
+
+    if (error.empty())
+    {
+        logText(genVariantReport(names, sims));
+        this->config->flushLog();
+    }
+
+    for (Simulation *sim: sims)
+    {
+        delete sim;
+    }
+
+    if (!error.empty())
+    {
+        throw error;
+    }
+}
+
+/**
+ * @brief      Generates a report comparing finished variants side by side.
+ *
+ * @param[in]  names  The variant names
+ * @param[in]  sims   The finished variants
+ *
+ * @return     The report.
+ */
+std::string Simulation::genVariantReport(const std::vector<std::string> &names,
+                                         const std::vector<Simulation*> &sims)
+{
+    std::ostringstream out;
+
+    out << std::fixed << std::setprecision(3);
+    out << "What-if report (forked at " << stopUs / 1000.0 << " ms)\n";
+
+    for (unsigned k = 0; k < names.size(); k++)
+    {
+        out << "  [" << k << "] " << names[k] << "\n";
+    }
+
+    out << std::left << std::setw(24) << "Metric" << std::right;
+
+    for (unsigned k = 0; k < sims.size(); k++)
+    {
+        out << std::setw(12) << "[" + std::to_string(k) + "]";
+    }
+
+    out << "\n" << std::left << std::setw(24) << "End time (ms)" << std::right;
+
+    for (Simulation *sim: sims)
+    {
+        out << std::setw(12) << sim->clock.getMicroseconds() / 1000.0;
+    }
+
+    out << "\n" << std::left << std::setw(24) << "Mean turnaround (ms)" << std::right;
+
+    for (Simulation *sim: sims)
+    {
+        double sum = 0.0;
+
+        for (unsigned long long endUs: sim->procEndUs)
+        {
+            sum += endUs;
+        }
+
+        out << std::setw(12) << (sim->procEndUs.empty() ? 0.0 : 
+                                 sum / sim->procEndUs.size() / 1000.0);
+    }
+
+    out << "\n" << std::left << std::setw(24) << "Instructions" << std::right;
+
+    for (Simulation *sim: sims)
+    {
+        out << std::setw(12) << sim->stats.getTotalInstr();
+    }
+
+    out << "\n" << std::left << std::setw(24) << "Context switches" << std::right;
+
+    for (Simulation *sim: sims)
+    {
+        out << std::setw(12) << sim->stats.getSwitches();
+    }
+
+    out << "\n" << std::left << std::setw(24) << "Switch time (ms)" << std::right;
+
+    for (Simulation *sim: sims)
+    {
+        out << std::setw(12) << (sim->stats.getDispatchUs() + sim->stats.getSwitchUs() + 
+                                 sim->stats.getRefillUs()) / 1000.0;
+    }
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        bool used = false;
+
+        for (Simulation *sim: sims)
+        {
+            used = used || sim->stats.getDeviceOps((Device) d) != 0;
+        }
+
+        if (!used)
+        {
+            continue;
+        }
+
+        out << "\n" << std::left << std::setw(24) << DEVICE_NAMES[d] + " time (ms)" 
+            << std::right;
+
+        for (Simulation *sim: sims)
+        {
+            out << std::setw(12) << sim->stats.getDeviceTime((Device) d);
+        }
+    }
+
+    bool threaded = false;
+
+    for (Simulation *sim: sims)
+    {
+        threaded = threaded || sim->stats.getRegions() != 0;
+    }
+
+    if (threaded)
+    {
+        out << "\n" << std::left << std::setw(24) << "Thread speedup" << std::right;
+
+        for (Simulation *sim: sims)
+        {
+            unsigned long long workUs = 0, spanUs = 0;
+
+            for (unsigned k = 0; k < sim->pcbTable.size(); k++)
+            {
+                workUs += sim->stats.getProcWorkUs(k);
+                spanUs += sim->stats.getProcSpanUs(k);
+            }
+
+            out << std::setw(12) << (spanUs == 0 ? 1.0 : (double) workUs / spanUs);
+        }
+    }
+
+    if (this->power.getNumStates() != 0)
+    {
+        out << "\n" << std::left << std::setw(24) << "Energy (J)" << std::right;
+
+        for (Simulation *sim: sims)
+        {
+            out << std::setw(12) << sim->power.getEnergy();
+        }
+    }
+
+    out << "\n\n";
+
+    return out.str();
+}
+
+/**
+ * @brief      Picks the next ready process according to given algorithm (PS, 
+ *             SJF, or FCFS). Ties go to the lowest pid.
+ *
+ * @param[in]  algo  The scheduling algorithm
+ * @param      idx   The PCB table index of the picked process
+ *
+ * @return     false if no process is ready, true otherwise
+ */
+bool Simulation::pickNextProcess(const std::string &algo, unsigned &idx)
+{
+    PROFILE_SCOPE(PHASE_SCHEDULE);
+
+    if (algo == "PS")
+    {
+        return pcbTable.pickMax(KEY_NUM_IO_INSTR, idx);
+    }
+    else if (algo == "SJF")
+    {
+        return pcbTable.pickMin(KEY_NUM_INSTR, idx);
+    }
+
+    return pcbTable.pickMin(KEY_PID, idx);
+}
+
+/**
+ * @brief      Prints the contents of the ready set
+ */
+void Simulation::printReadyQueue()
+{
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        if (pcbTable.getState(k) == READY)
+        {
+            std::cout << pcbTable.getPCB(k) << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief      Prints the contents of the wait set
+ */
+void Simulation::printWaitQueue()
+{
+    for (unsigned k = 0; k < pcbTable.size(); k++)
+    {
+        if (pcbTable.getState(k) == WAIT)
+        {
+            std::cout << pcbTable.getPCB(k) << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief      Prints the contents of the specified queue ("wait" or "ready")
+ *
+ * @param[in]  queueType  The queue type
+ */
+void Simulation::printQueue(std::string queueType)
+{
+    std::cout << "\nPrinting the contents of " << queueType << "queue...\n\n";
+
+    if (queueType == "ready")
+    {
+        this->printReadyQueue();
+    }
+    else if (queueType == "wait")
+    {
+        this->printWaitQueue();
+    }
+}
+
+/**
+ * @brief      Prints the contents of processVector
+ */
+void Simulation::printProcessVector()
+{
+    std::cout << "\nPrinting the contents of processVector...\n\n";
+    for (unsigned k = 0; this->processVector && k < this->processVector->size(); k++)
+    {
+        Process tempProcess = (*processVector)[k];
+
+        std::cout << tempProcess << std::endl;
+    }
+}
+
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Splits a comma-separated config list, dropping the spaces 
+ *             around each item.
+ *
+ * @param[in]  list  The list
+ *
+ * @return     The items (none if the list is empty).
  */
-void wait(float duration)
+static std::vector<std::string> splitList(const std::string &list)
 {
-    Timer myTimer;
+    std::vector<std::string> items;
+    size_t pos = 0;
+
+    while (pos < list.length())
+    {
+        size_t end = list.find(',', pos);
+        std::string item = list.substr(pos, end == std::string::npos ? 
+                                            std::string::npos : end - pos);
+        size_t first = item.find_first_not_of(' ');
+
+        pos = (end == std::string::npos) ? list.length() : end + 1;
+
+        if (first == std::string::npos)
+        {
+            throw std::string("Error: empty item in list \"" + list + "\"");
+        }
+
+        items.push_back(item.substr(first, item.find_last_not_of(' ') - first + 1));
+    }
 
-    myTimer.startTimer();
-    while (myTimer.getDuration() < duration);
+    return items;
 }
 
 /**
@@ -424,19 +3152,25 @@ void wait(float duration)
  * @param[in]  blockSize     The block size
  * @param      memAddr       The memory address
  * @param[in]  sysMem        The system memory
+ * @param      clock         The simulation clock
+ * @param      memMutex      The memory management mutex
+ * @param[in]  waitTime      The time the operation takes (ms)
  */
 void executeMemInstruction(
-    MetadataInstruction instr, 
+    const MetadataInstruction &instr, 
     unsigned &nextBlockPtr, 
     unsigned blockSize, 
     unsigned &memAddr,
-    unsigned sysMem)
+    unsigned sysMem,
+    SimClock &clock,
+    pthread_mutex_t &memMutex,
+    float waitTime)
 {
-    std::string descriptor = instr.getDescriptor();
+    Descriptor descId = instr.getDescId();
 
-    pthread_mutex_lock(&mutex);
+    pthread_mutex_lock(&memMutex);
 
-    if (descriptor == "allocate")
+    if (descId == DESC_ALLOCATE)
     {
         if (sysMem - nextBlockPtr >= blockSize)
         {
@@ -449,35 +3183,55 @@ void executeMemInstruction(
             nextBlockPtr = blockSize;
         }
     }
-    else if (descriptor == "block")
+    else if (descId == DESC_BLOCK)
     {
         /* For now, do nothing */
     }
 
-    wait(instr.getWaitTime());
+    clock.advance(waitTime);
     
-    pthread_mutex_unlock(&mutex);
+    pthread_mutex_unlock(&memMutex);
 }
 
 /**
- * @brief      Executes an IO instruction
+ * @brief      Device thread executing an IO instruction: waits until the 
+ *             operation's completion time and posts its completion record. 
+ *             The record belongs to the scheduler once posted.
  *
- * @param      param  The parameter holding the instruction
+ * @param      param  The ioCompletion of the operation
  *
  * @return     None
  */
 void* executeIOInstruction(void* param)
 {
-    MetadataInstruction instr = *((MetadataInstruction*)param);
-    sem_t *semPtr;
+    ioCompletion *rec = (ioCompletion*)param;
 
-    semPtr = instr.getSemPtr();
+    rec->clock->advanceTo(rec->completeUs);
+    rec->queue->push(rec);
 
-    sem_wait(semPtr);
+    return 0;
+}
 
-    wait(instr.getWaitTime());
+/**
+ * @brief      Thread that runs a what-if variant to completion, recording any
+ *             error instead of throwing across the thread boundary.
+ *
+ * @param      param  The variantRun to execute
+ *
+ * @return     None
+ */
+void* runVariantThread(void* param)
+{
+    variantRun &run = *((variantRun*)param);
 
-    sem_post(semPtr);
+    try
+    {
+        run.sim->startSimulation();
+    }
+    catch (std::string &e)
+    {
+        run.error = e;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -5,6 +5,120 @@
  * 
  * @details Specifies all member methods of the Simulation class
  * 
+ * @version 1.26
+ *          Adam Landis (19 October 2026)
+ *          Add the wall Timer (wallTimer)
+ * 
+ * @version 1.25
+ *          Adam Landis (19 October 2026)
+ *          accessCache() takes the index of the instruction
+ * 
+ * @version 1.24
+ *          Adam Landis (19 October 2026)
+ *          Add regionThread and threadRegion structs, runThreads(), 
+ *          advanceThread(), logThreadInstr() and logThreadReport() for 
+ *          fork/join regions, and the number of processors (numCPUs)
+ * 
+ * @version 1.23
+ *          Adam Landis (19 October 2026)
+ *          Add the processor power model (power) and logPowerReport()
+ * 
+ * @version 1.22
+ *          Adam Landis (19 October 2026)
+ *          Replace metadata with the metadata of each tenant (tenants) and 
+ *          their weights (tenantWeights); add logTenantReport()
+ * 
+ * @version 1.21
+ *          Adam Landis (19 October 2026)
+ *          Add the event log encoder (events), textLog and binaryLog flags, 
+ *          emitEvent() and logText()
+ * 
+ * @version 1.20
+ *          Adam Landis (19 October 2026)
+ *          Add dispatchProcess() and logSwitchReport() with the switch cost 
+ *          and last process data members
+ * 
+ * @version 1.19
+ *          Adam Landis (19 October 2026)
+ *          - Add the cache hierarchy (cache), the blocks allocated by each 
+ *            process (procBlocks), accessCache() and logCacheReport()
+ *          - Add the waitTime parameter of executeMemInstruction()
+ * 
+ * @version 1.18
+ *          Adam Landis (19 October 2026)
+ *          Add the I/O submission queues (batchers), sealBatch(), 
+ *          flushIOBatches() and logCoalesceReport()
+ * 
+ * @version 1.17
+ *          Adam Landis (19 October 2026)
+ *          Add the hard drive models (disks), startDisk(), logDiskReport() and
+ *          drainIOQueue()
+ * 
+ * @version 1.16
+ *          Adam Landis (19 October 2026)
+ *          Add stepProcess() and, with SIM_COROUTINES, runProcess()
+ * 
+ * @version 1.15
+ *          Adam Landis (19 October 2026)
+ *          - Replace the ioRequest struct, device semaphores and 
+ *            getDeviceSem() with an IOCompletionQueue that device threads post
+ *            completion records to, per-unit device free times and the pending
+ *            completion heap
+ *          - Add issueIO(), deliverIOCompletions(), waitForIOCompletion(), 
+ *            completeIO() and logInstrEnd()
+ * 
+ * @version 1.14
+ *          Adam Landis (19 October 2026)
+ *          Add setLiveStats() and publishLiveStats() with their data members
+ * 
+ * @version 1.13
+ *          Adam Landis (19 October 2026)
+ *          - Add what-if forking: setStopTime(), forkVariants() and a private
+ *            variant constructor sharing the parsed metadata and process 
+ *            table of its base simulation
+ *          - Move the memory mutex and device semaphores into data members
+ *          - Hold metadata and processVector through shared pointers
+ * 
+ * @version 1.12
+ *          Adam Landis (19 October 2026)
+ *          Add checkpoint/restore: setResumeCheckpoint(), maybeCheckpoint(), 
+ *          saveCheckpoint() and restoreCheckpoint() with their data members
+ * 
+ * @version 1.11
+ *          Adam Landis (19 October 2026)
+ *          - Replace the Timer data member and wait() functions with a SimClock
+ *            that runs in real or virtual time
+ *          - Add setTimeline(), getSimMicroseconds() and emitLog() so every 
+ *            event line can be recorded to a Timeline
+ *          - Add ioRequest struct for executeIOInstruction()
+ * 
+ * @version 1.10
+ *          Adam Landis (19 October 2026)
+ *          - Replace readyQueue and waitQueue with a PCBTable data member
+ *          - Replace sortReadyQueue() and its comparator structs with 
+ *            pickNextProcess()
+ * 
+ * @version 1.09
+ *          Adam Landis (19 October 2026)
+ *          Pass instructions by const reference to executeInstruction() and 
+ *          executeMemInstruction()
+ * 
+ * @version 1.08
+ *          Adam Landis (19 October 2026)
+ *          - Add SimStats data member and quiet flag for "Log Summary" mode
+ *          - executeInstruction() takes the number of cycles to execute
+ * 
+ * @version 1.07
+ *          Adam Landis (19 October 2026)
+ *          - Add method prototypes logEvent() for allocation-free log lines
+ *          - Add destructor
+ * 
+ * @version 1.06
+ *          Adam Landis (19 October 2026)
+ *          - Add method prototypes executeInstruction(), runProportionalShare()
+ *            and logShareReport()
+ *          - Move timer, device counters and memory state into data members
+ * 
  * @version 1.05
  *          Adam Landis (24 April 2019)
  *          Remove method prototypes for sortByPS(), sortBySJF(), and 
@@ -46,10 +160,12 @@
 #include <string>
 #include <iomanip>      // setprecision, fixed
 #include <pthread.h>    // for threads
-#include <semaphore.h>  // for semaphores
-#include <queue>        // for ready and wait queues
 #include <vector>       // for vector of processes
 #include <algorithm>    // std::sort
+#include <sstream>      // ostringstream
+#include <memory>       // shared_ptr
+#include <queue>        // pending I/O completions, thread ends and waiters
+#include <functional>   // std::greater
 
 #include "helpers.h"
 #include "Config.h"
@@ -57,69 +173,204 @@
 #include "Metadata.h"
 #include "Process.h"
 #include "PCB.h"
+#include "PCBTable.h"
 #include "Timer.h"
-//
-// Free Function Prototypes ////////////////////////////////////////////////////
-//
-void* wait(void* param);
-void wait(float duration);
-void executeMemInstruction(
-    MetadataInstruction instr, 
-    unsigned &nextBlockPtr, 
-    unsigned blockSize, 
-    unsigned &memAddr,
-    unsigned sysMem);
-void* executeIOInstruction(void* param);
+#include "SimClock.h"
+#include "Timeline.h"
+#include "Checkpoint.h"
+#include "LiveStats.h"
+#include "IOCompletionQueue.h"
+#include "ProcessTask.h"
+#include "DiskScheduler.h"
+#include "IOBatcher.h"
+#include "CacheModel.h"
+#include "PowerModel.h"
+#include "ShareScheduler.h"
+#include "LogBuffer.h"
+#include "EventLog.h"
+#include "SimStats.h"
 //
 // Struct Definitions //////////////////////////////////////////////////////////
 //
-struct by_largestNumIOInstr
+class Simulation;
+
+struct variantRun
 {
-    bool operator()(PCB const &lhsPCB, PCB const &rhsPCB) const
-    {
-        return lhsPCB.getNumIOInstr() > rhsPCB.getNumIOInstr();
-    }
+    Simulation *sim;
+    std::string error;
 };
 
-struct by_smallestNumInstr
+/**
+ * Struct to hold one thread of a fork/join region: its instructions, as 
+ * indices into the process or forks of other threads, and its progress
+ */
+struct regionThread
 {
-    bool operator()(PCB const &lhsPCB, PCB const &rhsPCB) const
-    {
-        return lhsPCB.getNumInstr() < rhsPCB.getNumInstr();
-    }
+    std::vector<unsigned> items;
+    unsigned pos;
+    unsigned fork;              // index of the T{fork} that started it
+    unsigned unit;              // device unit of the instruction in progress
+    unsigned memAddr;           // address it allocated (M{allocate} only)
+    float waitTime;             // time of the instruction in progress (ms)
+    bool onCPU;
 };
 
-struct by_smallestPID
+/**
+ * Struct to hold a fork/join region of a process while it runs
+ */
+struct threadRegion
 {
-    bool operator()(PCB const &lhsPCB, PCB const &rhsPCB) const
-    {
-        return lhsPCB.getPID() < rhsPCB.getPID();
-    }
+    std::vector<regionThread> threads;      // main thread first
+    std::priority_queue<std::pair<unsigned long long, unsigned>, 
+                        std::vector<std::pair<unsigned long long, unsigned> >,
+                        std::greater<std::pair<unsigned long long, unsigned> > > ends;
+    std::queue<unsigned> cpuWaiters;        // threads waiting for a processor
+    unsigned join;                          // index of the T{join}, if any
+    unsigned freeCPUs;
+    unsigned long long nowUs, workUs;
+    unsigned long cycles;                   // processor cycles executed
+    double slowdown;                        // of P{run} in the current P-state
 };
 //
+// Typedefs ////////////////////////////////////////////////////////////////////
+//
+typedef std::pair<unsigned long long, unsigned> ioEvent;   // (completeUs, idx)
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+void executeMemInstruction(
+    const MetadataInstruction &instr, 
+    unsigned &nextBlockPtr, 
+    unsigned blockSize, 
+    unsigned &memAddr,
+    unsigned sysMem,
+    SimClock &clock,
+    pthread_mutex_t &memMutex,
+    float waitTime);
+void* executeIOInstruction(void* param);
+void* runVariantThread(void* param);
+//
 // Class Definition ////////////////////////////////////////////////////////////
 // 
 class Simulation
 {
 public:
     Simulation(const std::string& configFilename);
+    ~Simulation();
 
     void createProcesses();
     void startSimulation();
+    void setTimeline(Timeline *timeline);
+    void setResumeCheckpoint(Checkpoint *ckpt);
+    void setStopTime(unsigned long long stopUs);
+    void setLiveStats(LiveStats *liveStats, unsigned long long intervalUs);
+    void forkVariants(const std::vector<std::string> &specs);
+    unsigned long long getSimMicroseconds();
+
+    void executeInstruction(unsigned idx, const MetadataInstruction &instr, unsigned long cycles);
+    bool stepProcess(const Process &process, unsigned idx, unsigned i);
+    unsigned runThreads(unsigned idx, const Process &process, unsigned fork, 
+                        unsigned long &cycles);
+    void advanceThread(threadRegion &region, unsigned idx, const Process &process, 
+                       unsigned t);
+#if SIM_COROUTINES
+    ProcessTask runProcess(unsigned idx);
+#endif
+    void issueIO(unsigned idx, const MetadataInstruction &instr, unsigned unit);
+    void postIO(ioCompletion &rec);
+    void deliverIOCompletions();
+    void drainIOQueue();
+    bool waitForIOCompletion();
+    void completeIO(unsigned idx);
+    void startDisk(unsigned unit, unsigned long long freeUs);
+    void logDiskReport();
+    void sealBatch(unsigned dev, unsigned unit, unsigned long long atUs);
+    void flushIOBatches(bool all);
+    void logCoalesceReport();
+    float accessCache(unsigned idx, const MetadataInstruction &instr, unsigned instrIdx,
+                      unsigned long cycles, unsigned memAddr, float waitTime);
+    void logCacheReport();
+    void logPowerReport();
+    void dispatchProcess(unsigned idx);
+    void logSwitchReport(std::string algo);
+    void logTenantReport();
+    void logInstrEnd(unsigned pid, const MetadataInstruction &instr, unsigned memAddr);
+    void logThreadInstr(unsigned pid, unsigned thread, const MetadataInstruction &instr, 
+                        bool isStart, unsigned long long arg);
+    void logThreadReport();
+    void runProportionalShare(std::string algo);
+    void logShareReport(std::string algo);
+    void logEvent(const char *msg);
+    void logEvent(const char *prefix, unsigned pid, const char *suffix);
+    void emitLog(bool isInstrLine);
+    void emitEvent();
+    void logText(const std::string &data);
+    void publishLiveStats(bool finished);
 
-    void sortReadyQueue(std::string algo);
+    void maybeCheckpoint(const ShareScheduler *scheduler);
+    void saveCheckpoint(const ShareScheduler *scheduler);
+    void writeCheckpoint(Checkpoint &ckpt, const ShareScheduler *scheduler);
+    void restoreCheckpoint();
+    bool reachedStop(const ShareScheduler *scheduler);
+    std::string genVariantReport(const std::vector<std::string> &names,
+                                 const std::vector<Simulation*> &sims);
+
+    bool pickNextProcess(const std::string &algo, unsigned &idx);
 
     void printReadyQueue();
     void printWaitQueue();
     void printQueue(std::string queueType);
     void printProcessVector();
 private:
+    Simulation(const Simulation &base, const std::string &spec);
+
     std::string configFilename;
     Config *config;
-    Metadata *metadata;
-    std::queue<PCB> readyQueue;
-    std::queue<PCB> waitQueue;
-    std::vector<Process> processVector;
+    std::vector<std::shared_ptr<Metadata> > tenants;    // "File Path" first
+    std::vector<unsigned> tenantWeights;
+    PCBTable pcbTable;
+    std::shared_ptr<const std::vector<Process> > processVector;
+    std::vector<unsigned long long> procEndUs;
+    pthread_mutex_t memMutex;
+    SimClock clock;
+    Timer wallTimer;                    // real time of the run, for the summary
+    Timeline *timeline;
+    unsigned numHD, countHD, numProj, countProj;
+    unsigned numCPUs;                   // processors for a process's threads
+    unsigned sysMem, memBlockSize, nextBlockPtr;
+    bool quiet, textLog, binaryLog;
+    EventLog events;
+    SimStats stats;
+    std::vector<unsigned> sharePIDs, shareTickets;
+    std::vector<unsigned long long> shareCycles, shareWindowCycles;
+    bool shareWindowOpen;
+    Checkpoint *resumeCkpt;
+    std::string ckptFilename;
+    unsigned long long ckptIntervalUs, nextCkptUs;
+    unsigned activeIdx;
+    unsigned long long stopUs;
+    bool stopped, isVariant;
+    Checkpoint forkCkpt;
+    LiveStats *liveStats;
+    unsigned long long liveIntervalUs, nextLiveUs;
+    unsigned busyUnits[NUM_DEVICES];
+    bool interruptIO;
+    unsigned long interruptCostUs;
+    IOCompletionQueue ioQueue;
+    std::vector<ioCompletion> ioSlots;
+    std::priority_queue<ioEvent, std::vector<ioEvent>, std::greater<ioEvent> > ioPending;
+    std::vector<unsigned long long> unitFreeUs[NUM_DEVICES];
+    unsigned ioInFlight;
+    std::vector<DiskScheduler> disks;   // hard drive models (empty if unused)
+    unsigned long coalesceUs;
+    std::vector<IOBatcher> batchers;    // per device (empty if not coalescing)
+    std::vector<unsigned> batchMembers;
+    CacheModel cache;                   // no levels if unused
+    PowerModel power;                   // no P-states if unused
+    std::vector<std::vector<unsigned> > procBlocks;
+    unsigned long switchCostUs, dispatchCostUs, refillCostUs;
+    unsigned lastIdx;                   // last process dispatched
+    bool lastVoluntary;                 // it left the processor for I/O
 };
 //
 // Terminating Precompiler Directives
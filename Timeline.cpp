@@ -0,0 +1,216 @@
+/**
+ * @file Timeline.cpp
+ * 
+ * @brief Implementation file for Timeline class
+ * 
+ * @details Implements all member methods of Timeline class
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Timeline class
+ * 
+ * @note Requries Timeline.h
+ */ 
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include "Timeline.h"
+
+#include <cmath>        // llround
+#include <cstdlib>      // strtod
+//
+// Class Member Implementation /////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Constructs the object, opening the output and golden files.
+ *
+ * @param[in]  outFilename     The timeline output file (empty for none)
+ * @param[in]  goldenFilename  The golden timeline file (empty for none)
+ * @param[in]  toleranceUs     The allowed timestamp deviation in microseconds
+ */
+Timeline::Timeline(const std::string& outFilename, 
+                   const std::string& goldenFilename,
+                   unsigned long long toleranceUs) : 
+    toleranceUs(toleranceUs), numLines(0)
+{
+    if (!outFilename.empty())
+    {
+        this->out.open(outFilename.c_str(), std::ofstream::trunc);
+
+        if (!this->out.is_open())
+        {
+            throw std::string("Error: could not open timeline file \"" + 
+                              outFilename + "\"");
+        }
+    }
+
+    if (!goldenFilename.empty())
+    {
+        this->golden.open(goldenFilename.c_str());
+
+        if (!this->golden.is_open())
+        {
+            throw std::string("Error: could not open golden timeline file \"" +
+                              goldenFilename + "\"");
+        }
+    }
+}
+
+/**
+ * @brief      Destroys the object, flushing the timeline file.
+ */
+Timeline::~Timeline()
+{
+    if (this->out.is_open())
+    {
+        this->out.close();
+    }
+}
+
+/**
+ * @brief      Records log output, one event per newline-terminated line.
+ *
+ * @param[in]  data  The log data
+ * @param[in]  len   The length of the log data
+ */
+void Timeline::record(const char *data, size_t len)
+{
+    if (this->out.is_open())
+    {
+        this->out.write(data, len);
+    }
+
+    if (!this->golden.is_open())
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            this->numLines += (data[i] == '\n');
+        }
+
+        return;
+    }
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (data[i] == '\n')
+        {
+            this->numLines++;
+            this->compareLine(this->pending);
+            this->pending.clear();
+        }
+        else
+        {
+            this->pending += data[i];
+        }
+    }
+}
+
+/**
+ * @brief      Finishes the comparison, checking that the golden timeline has 
+ *             no events left.
+ *
+ * @return     True if the timeline matched the golden timeline (or there was 
+ *             none), False otherwise.
+ */
+bool Timeline::finish()
+{
+    std::string line;
+
+    if (this->out.is_open())
+    {
+        this->out.flush();
+    }
+
+    if (this->golden.is_open() && this->divergence.empty() && 
+        std::getline(this->golden, line))
+    {
+        this->divergence = "line " + std::to_string(this->numLines + 1) + 
+                           ": expected \"" + line + "\", got end of timeline";
+    }
+
+    return this->divergence.empty();
+}
+
+/**
+ * @brief      Compares an event line against the next golden line, recording 
+ *             the first divergence.
+ *
+ * @param[in]  actual  The event line produced by the simulation
+ */
+void Timeline::compareLine(const std::string& actual)
+{
+    std::string expected, actualEvent, expectedEvent;
+    unsigned long long actualUs, expectedUs, diff;
+
+    if (!this->divergence.empty())
+    {
+        return;
+    }
+
+    if (!std::getline(this->golden, expected))
+    {
+        this->divergence = "line " + std::to_string(this->numLines) + 
+                           ": expected end of timeline, got \"" + actual + "\"";
+        return;
+    }
+
+    if (!this->parseLine(actual, actualUs, actualEvent) || 
+        !this->parseLine(expected, expectedUs, expectedEvent))
+    {
+        if (actual != expected)
+        {
+            this->divergence = "line " + std::to_string(this->numLines) + 
+                               ": expected \"" + expected + "\", got \"" + 
+                               actual + "\"";
+        }
+
+        return;
+    }
+
+    diff = actualUs > expectedUs ? actualUs - expectedUs : 
+                                   expectedUs - actualUs;
+
+    if (actualEvent != expectedEvent || diff > this->toleranceUs)
+    {
+        this->divergence = "line " + std::to_string(this->numLines) + 
+                           ": expected \"" + expected + "\", got \"" + 
+                           actual + "\"";
+    }
+}
+
+/**
+ * @brief      Splits an event line of the form "<seconds> - <event>" into its 
+ *             timestamp and event text.
+ *
+ * @param[in]  line   The event line
+ * @param      us     The timestamp in microseconds
+ * @param      event  The event text
+ *
+ * @return     True if the line has a timestamp, False otherwise.
+ */
+bool Timeline::parseLine(const std::string& line, unsigned long long &us, 
+                         std::string &event) const
+{
+    size_t sep = line.find(" - ");
+    const char *begin = line.c_str();
+    char *end;
+    double seconds;
+
+    if (sep == std::string::npos)
+    {
+        return false;
+    }
+
+    seconds = strtod(begin, &end);
+
+    if (end != begin + sep || seconds < 0)
+    {
+        return false;
+    }
+
+    us = (unsigned long long) llround(seconds * 1000000.0);
+    event = line.substr(sep + 3);
+
+    return true;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file Timeline.h
+ * 
+ * @brief Definition file for Timeline class
+ * 
+ * @details Specifies all member methods of the Timeline class, which records 
+ *          every simulation event line to a file and/or compares the events 
+ *          against a golden timeline as they are produced
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development and testing of Timeline class
+ * 
+ * @note None
+ */
+//
+// Precompiler Directives //////////////////////////////////////////////////////
+//
+#ifndef TIMELINE_H
+#define TIMELINE_H
+//
+// Header Files ////////////////////////////////////////////////////////////////
+// 
+#include <string>
+#include <fstream>      // ifstream, ofstream
+//
+// Class Definition ////////////////////////////////////////////////////////////
+// 
+class Timeline
+{
+public:
+    Timeline(const std::string& outFilename, const std::string& goldenFilename,
+             unsigned long long toleranceUs);
+    ~Timeline();
+
+    void record(const char *data, size_t len);
+    bool finish();
+
+    /**
+     * @brief      Gets the number of event lines recorded.
+     *
+     * @return     The number of lines.
+     */
+    inline unsigned long long getNumLines() const { return this->numLines; }
+
+    /**
+     * @brief      Determines if a golden timeline is being compared.
+     *
+     * @return     True if comparing, False otherwise.
+     */
+    inline bool hasGolden() const { return this->golden.is_open(); }
+
+    /**
+     * @brief      Gets a description of the first divergence from the golden 
+     *             timeline.
+     *
+     * @return     The description (empty if none).
+     */
+    inline const std::string& getDivergence() const { return this->divergence; }
+private:
+    void compareLine(const std::string& actual);
+    bool parseLine(const std::string& line, unsigned long long &us, 
+                   std::string &event) const;
+
+    std::ofstream out;
+    std::ifstream golden;
+    unsigned long long toleranceUs;
+    unsigned long long numLines;
+    std::string pending;
+    std::string divergence;
+};
+//
+// Terminating Precompiler Directives
+// 
+#endif  // TIMELINE_H
+//
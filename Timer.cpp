@@ -71,3 +71,18 @@ float Timer::getDuration()
 
     return this->duration.count() * 1000.0f;
 }
+
+/**
+ * @brief      Gets the duration since start time in whole microseconds, for 
+ *             fixed-point timestamps.
+ *
+ * @return     The duration in microseconds.
+ */
+unsigned long long Timer::getMicroseconds()
+{
+    timepoint time_end = this->isRunning ? 
+        std::chrono::high_resolution_clock::now() : this->endTime;
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        time_end - this->startTime).count();
+}
@@ -5,6 +5,10 @@
  * 
  * @details Specifies all member methods of the Timer class
  * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Add getMicroseconds() method prototype
+ * 
  * @version 1.00
  *          Adam Landis (13 March 2019)
  *          Initial development and testing of Timer class
@@ -35,6 +39,7 @@ public:
     void startTimer();
     void stopTimer();
     float getDuration();
+    unsigned long long getMicroseconds();
 private:
     timepoint startTime, endTime;
     std::chrono::duration<float> duration;
@@ -7,6 +7,10 @@
  *             program. Contains the function implementations for functions
  *             defined in helpers.h.
  *             
+ * @version    1.01
+ *             Adam Landis (19 October 2026)
+ *             Add mixBits()
+ *             
  * @version    1.00
  *             Adam Landis (8 April 2019)
  *             Move all helper function bodies out of main and into 
@@ -218,4 +222,21 @@ std::string uintToHexStr(unsigned num)
     stream.fill('0');
     stream << std::hex << num;
     return "0x" + std::string(stream.str());
-}
\ No newline at end of file
+}
+
+/**
+ * @brief      Scrambles a value (splitmix64 finalizer), used to place disk 
+ *             requests and memory accesses deterministically.
+ *
+ * @param[in]  x     The value
+ *
+ * @return     The scrambled value.
+ */
+unsigned long long mixBits(unsigned long long x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+    return x ^ (x >> 31);
+}
@@ -7,6 +7,10 @@
  *             Contains the function prototypes and includes any other headers
  *             as needed.
  *             
+ * @version    1.01
+ *             Adam Landis (19 October 2026)
+ *             Add mixBits()
+ *             
  * @version    1.00
  *             Adam Landis (8 April 2019)
  *             Move all helper function prototypes out of main and into 
@@ -42,6 +46,7 @@ void logToFile(std::string& logData, std::string& logFilename,
                std::ios_base::openmode mode = std::ios_base::app);
 unsigned genRandNum();
 std::string uintToHexStr(unsigned num);
+unsigned long long mixBits(unsigned long long x);
 //
 // Terminating Precompiler Directives
 // 
@@ -7,6 +7,32 @@
  *
  * @details This program is the driver program for OS Simulator classes
  * 
+ * @version 4.07
+ *          Adam Landis (19 October 2026)
+ *          Accept "--tolerance 0"
+ * 
+ * @version 4.06
+ *          Adam Landis (19 October 2026)
+ *          Add "--stats-file" and "--stats-interval" live statistics options
+ * 
+ * @version 4.05
+ *          Adam Landis (19 October 2026)
+ *          Add "--profile" and "--profile-json" phase profiling options
+ * 
+ * @version 4.04
+ *          Adam Landis (19 October 2026)
+ *          Add "--fork-at" and "--variant" for what-if branching
+ * 
+ * @version 4.03
+ *          Adam Landis (19 October 2026)
+ *          Add "--resume <checkpoint>" to continue a checkpointed run
+ * 
+ * @version 4.02
+ *          Adam Landis (19 October 2026)
+ *          Add regression-check options: --timeline and --golden record and
+ *          compare the event timeline, --max-wall and --max-rss bound wall 
+ *          time and peak memory, and --report writes a one-line JSON result.
+ * 
  * @version 4.01
  *          Adam Landis (24 April 2019)
  *          Remove call to Simulation::createProcesses()
@@ -127,18 +153,57 @@
  * of the configuration file to be used to initialize the OS simulator. This
  * config file contains the filename of a meta data file for use in loading the
  * operations to perform in the OS simulator.
+ *
+ * Alternatively, "--resume <checkpoint>" continues a run from a checkpoint 
+ * file written during an earlier run (see "Checkpoint Interval {msec}"); the 
+ * configuration file recorded in the checkpoint is used.
+ *
+ * Optional regression-check arguments may follow either form:
+ *   --timeline <file>    write every event line to <file>
+ *   --golden <file>      compare the event lines against <file>
+ *   --tolerance <us>     allowed timestamp deviation from golden (default 0)
+ *   --max-wall <sec>     fail if the run takes longer than <sec> wall seconds
+ *   --max-rss <MB>       fail if peak resident memory exceeds <MB>
+ *   --report <file>      write a one-line JSON result to <file>
+ * The program exits with status 2 if any check fails.
+ *
+ * What-if branching runs the simulation up to a time once and then continues 
+ * it in parallel under several variants, reporting them side by side:
+ *   --fork-at <msec>     stop the run at <msec> of simulated time and fork
+ *   --variant <spec>     a variant's overrides, e.g. "Hard drive quantity=4;
+ *                        System memory=2048" (may be repeated)
+ *
+ * Profiling reports wall time, call counts and heap allocations per phase at 
+ * exit:
+ *   --profile            print the profile to the monitor
+ *   --profile-json <file> also write the profile as JSON to <file>
+ *
+ * Live statistics for the simstat tool are published to a memory-mapped file:
+ *   --stats-file <file>  publish snapshots of the run to <file>
+ *   --stats-interval <msec> simulated time between snapshots (default 100)
  */
 // Header Files ////////////////////////////////////////////////////////////////
 //
 #include <iostream>     // cout
 #include <string>       // string
+#include <fstream>      // ofstream
+#include <vector>       // variant specs
+#include <sys/resource.h> // getrusage
 
 #include "Simulation.h"
+#include "Timer.h"
+#include "Timeline.h"
+#include "Checkpoint.h"
+#include "Profiler.h"
+#include "LiveStats.h"
+#include "helpers.h"
 //
 // Main Function Implementation ////////////////////////////////////////////////
 //
 int main(int argc, char *argv[])
 {
+    bool passed = true;
+
     try
     {
         if (argc == 1)
@@ -147,10 +212,210 @@ int main(int argc, char *argv[])
         }
 
         std::string configFilename = argv[1];
+        std::string timelineFilename, goldenFilename, reportFilename, profileFilename;
+        std::string statsFilename;
+        unsigned long statsIntervalMs = 100;
+        unsigned long toleranceUs = 0, maxWallSec = 0, maxRssMB = 0, forkAtMs = 0;
+        std::vector<std::string> variantSpecs;
+        Checkpoint resumeCkpt;
+        bool resume = (configFilename == "--resume");
+        int firstOption = 2;
+        bool profile = false;
+
+        if (resume)
+        {
+            if (argc == 2)
+            {
+                throw std::string("Error: missing argument for checkpoint file");
+            }
+
+            resumeCkpt.load(argv[2]);
+            configFilename = resumeCkpt.getString();
+            firstOption = 3;
+        }
+
+        for (int i = firstOption; i < argc; i++)
+        {
+            std::string option = argv[i];
+
+            if (option == "--profile")
+            {
+                profile = true;
+                continue;
+            }
+
+            if (i + 1 >= argc)
+            {
+                throw std::string("Error: missing value for option \"" + option + "\"");
+            }
+
+            std::string value = argv[++i];
+
+            if (option == "--timeline")
+            {
+                timelineFilename = value;
+            }
+            else if (option == "--golden")
+            {
+                goldenFilename = value;
+            }
+            else if (option == "--report")
+            {
+                reportFilename = value;
+            }
+            else if (option == "--tolerance" && isNonNegativeInteger(value))
+            {
+                toleranceUs = strToUnsignedLong(value);
+            }
+            else if (option == "--max-wall" && isPositiveInteger(value))
+            {
+                maxWallSec = strToUnsignedLong(value);
+            }
+            else if (option == "--max-rss" && isPositiveInteger(value))
+            {
+                maxRssMB = strToUnsignedLong(value);
+            }
+            else if (option == "--fork-at" && isPositiveInteger(value))
+            {
+                forkAtMs = strToUnsignedLong(value);
+            }
+            else if (option == "--variant")
+            {
+                variantSpecs.push_back(value);
+            }
+            else if (option == "--stats-file")
+            {
+                statsFilename = value;
+            }
+            else if (option == "--stats-interval" && isPositiveInteger(value))
+            {
+                statsIntervalMs = strToUnsignedLong(value);
+            }
+            else if (option == "--profile-json")
+            {
+                profileFilename = value;
+                profile = true;
+            }
+            else
+            {
+                throw std::string("Error: invalid option \"" + option + " " + value + "\"");
+            }
+        }
+
+        Timer wallTimer;
+        LiveStats liveStats;
+        Timeline timeline(timelineFilename, goldenFilename, toleranceUs);
+        bool useTimeline = !timelineFilename.empty() || !goldenFilename.empty();
+
+        if (profile)
+        {
+            Profiler::enable();
+        }
+
+        wallTimer.startTimer();
 
         Simulation mySim(configFilename);
 
+        if (useTimeline)
+        {
+            mySim.setTimeline(&timeline);
+        }
+
+        if (resume)
+        {
+            mySim.setResumeCheckpoint(&resumeCkpt);
+        }
+
+        if (!statsFilename.empty())
+        {
+            liveStats.create(statsFilename);
+            mySim.setLiveStats(&liveStats, statsIntervalMs * 1000ULL);
+        }
+
+        if (forkAtMs != 0)
+        {
+            mySim.setStopTime(forkAtMs * 1000ULL);
+        }
+        else if (!variantSpecs.empty())
+        {
+            throw std::string("Error: --variant requires --fork-at");
+        }
+
         mySim.startSimulation();
+
+        if (forkAtMs != 0)
+        {
+            mySim.forkVariants(variantSpecs);
+        }
+
+        // BEGIN Regression checks
+        struct rusage usage;
+        float wallSec = wallTimer.getDuration() / 1000.0f;
+        unsigned long maxRssKB;
+        bool timelineOk = timeline.finish();
+
+        getrusage(RUSAGE_SELF, &usage);
+        maxRssKB = (unsigned long) usage.ru_maxrss;
+
+        if (!timelineOk)
+        {
+            std::cerr << "Timeline mismatch: " << timeline.getDivergence() << std::endl;
+            passed = false;
+        }
+
+        if (maxWallSec != 0 && wallSec > maxWallSec)
+        {
+            std::cerr << "Wall time " << wallSec << " s exceeds limit of " 
+                      << maxWallSec << " s" << std::endl;
+            passed = false;
+        }
+
+        if (maxRssMB != 0 && maxRssKB > maxRssMB * 1024)
+        {
+            std::cerr << "Peak RSS " << maxRssKB << " KB exceeds limit of " 
+                      << maxRssMB << " MB" << std::endl;
+            passed = false;
+        }
+
+        if (!reportFilename.empty())
+        {
+            std::ofstream report(reportFilename.c_str(), std::ofstream::trunc);
+
+            if (!report.is_open())
+            {
+                throw std::string("Error: could not open report file \"" + 
+                                  reportFilename + "\"");
+            }
+
+            report << "{\"config\": \"" << configFilename << "\""
+                   << ", \"events\": " << timeline.getNumLines()
+                   << ", \"sim_us\": " << mySim.getSimMicroseconds()
+                   << ", \"wall_s\": " << wallSec
+                   << ", \"max_rss_kb\": " << maxRssKB
+                   << ", \"timeline\": \"" 
+                   << (!timeline.hasGolden() ? "unchecked" : 
+                       timelineOk ? "match" : "mismatch") << "\""
+                   << ", \"pass\": " << (passed ? "true" : "false") << "}\n";
+        }
+        // END Regression checks
+
+        if (profile)
+        {
+            std::cout << Profiler::genReport(wallSec * 1000.0);
+        }
+
+        if (!profileFilename.empty())
+        {
+            std::ofstream profileFile(profileFilename.c_str(), std::ofstream::trunc);
+
+            if (!profileFile.is_open())
+            {
+                throw std::string("Error: could not open profile file \"" + 
+                                  profileFilename + "\"");
+            }
+
+            profileFile << Profiler::genJSON(wallSec * 1000.0);
+        }
     }
     catch (std::string& e)
     {
@@ -158,5 +423,5 @@ int main(int argc, char *argv[])
         exit(1);
     }
 
-    return 0;
+    return passed ? 0 : 2;
 }
\ No newline at end of file
@@ -0,0 +1,319 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file mdgen.cpp
+ *
+ * @brief Statistical workload generator for the OS Simulator
+ *
+ * @details Emits a valid meta-data (.mdf) workload with a configurable number
+ *          of processes. Each process is a sequence of CPU bursts (P{run}) with
+ *          exponentially distributed cycle counts, each followed by a 
+ *          Poisson-distributed number of I/O operations and an optional memory
+ *          operation. The number of bursts per process follows a bounded 
+ *          Pareto (heavy-tailed) distribution. Output is streamed, so files of
+ *          any size are produced in constant memory.
+ * 
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Reject a mean of I/O operations of 0 and memory probabilities 
+ *          outside [0, 1]
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note None
+ */ 
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: mdgen [options]
+ *
+ *   -o <file>          output file (default: standard output)
+ *   -n <count>         number of processes (default: 10)
+ *   -s <seed>          random seed (default: 1)
+ *   -cpu <mean>        mean cycles per CPU burst (default: 8)
+ *   -io <rate>         mean I/O operations after each burst, above 0 
+ *                      (default: 1.0)
+ *   -iocycles <mean>   mean cycles per I/O operation (default: 5)
+ *   -mem <prob>        probability (0 to 1) of a memory operation per burst 
+ *                      (default: 0.2)
+ *   -alpha <shape>     Pareto shape of bursts per process (default: 1.5)
+ *   -bursts <min:max>  bounds on bursts per process (default: 1:1000)
+ *   -tickets <max>     give each process 1..max scheduling tickets 
+ *                      (default: 0, use the simulator default)
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout, cerr
+#include <fstream>      // ofstream
+#include <string>       // string
+#include <random>       // distributions
+#include <cmath>        // pow, ceil
+#include <algorithm>    // std::min, std::max
+#include <cstdlib>      // strtod, strtoul
+#include <cstdio>       // snprintf
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+// 
+const size_t OUTPUT_BUFFER_SIZE = 1 << 20;
+const unsigned INSTRUCTIONS_PER_LINE = 8;
+const char *IO_INSTRUCTIONS[] = {
+    "I{hard drive}", "O{hard drive}", "I{keyboard}", "I{scanner}", 
+    "O{monitor}", "O{projector}"
+};
+const char *MEM_INSTRUCTIONS[] = { "M{allocate}", "M{block}" };
+//
+// Struct Definitions //////////////////////////////////////////////////////////
+//
+/**
+ * Struct to hold the workload generation parameters
+ */
+struct genParams
+{
+    std::string outFile;
+    unsigned long numProcesses = 10;
+    unsigned long seed = 1;
+    double cpuMean = 8.0;
+    double ioRate = 1.0;
+    double ioMean = 5.0;
+    double memProb = 0.2;
+    double alpha = 1.5;
+    unsigned long minBursts = 1;
+    unsigned long maxBursts = 1000;
+    unsigned long maxTickets = 0;
+};
+
+/**
+ * Class to write instructions to a stream, breaking lines periodically
+ */
+class InstructionWriter
+{
+public:
+    InstructionWriter(std::ostream &out) : out(out), count(0) {}
+
+    /**
+     * @brief      Writes one instruction followed by ';'.
+     *
+     * @param[in]  instr   The instruction name (code and descriptor)
+     * @param[in]  cycles  The number of cycles
+     */
+    void write(const char *instr, unsigned long cycles)
+    {
+        char buf[64];
+        int len = snprintf(buf, sizeof(buf), "%s%s%lu;", 
+                           (this->count % INSTRUCTIONS_PER_LINE == 0) ? "" : " ", 
+                           instr, cycles);
+
+        this->out.write(buf, len);
+
+        if (++this->count % INSTRUCTIONS_PER_LINE == 0)
+        {
+            this->out.put('\n');
+        }
+    }
+
+    /**
+     * @brief      Writes the final instruction, terminated by '.'.
+     */
+    void finish()
+    {
+        if (this->count % INSTRUCTIONS_PER_LINE != 0)
+        {
+            this->out.put(' ');
+        }
+
+        this->out << "S{finish}0.\n";
+    }
+private:
+    std::ostream &out;
+    unsigned long count;
+};
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+genParams parseArgs(int argc, char *argv[]);
+void generateWorkload(const genParams &params, std::ostream &out);
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main(int argc, char *argv[])
+{
+    try
+    {
+        genParams params = parseArgs(argc, argv);
+
+        if (params.outFile.empty())
+        {
+            std::ios_base::sync_with_stdio(false);
+            generateWorkload(params, std::cout);
+        }
+        else
+        {
+            static char buffer[OUTPUT_BUFFER_SIZE];
+            std::ofstream outFile;
+
+            outFile.rdbuf()->pubsetbuf(buffer, OUTPUT_BUFFER_SIZE);
+            outFile.open(params.outFile, std::ios::out | std::ios::binary);
+
+            if (!outFile)
+            {
+                throw std::string("Error: unable to open output file \"" + 
+                                  params.outFile + "\"");
+            }
+
+            generateWorkload(params, outFile);
+            outFile.close();
+        }
+    }
+    catch (std::string& e)
+    {
+        std::cerr << e << std::endl;
+        exit(1);
+    }
+
+    return 0;
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Parses the command line arguments.
+ *
+ * @param[in]  argc  The argument count
+ * @param      argv  The arguments
+ *
+ * @return     The generation parameters
+ */
+genParams parseArgs(int argc, char *argv[])
+{
+    genParams params;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (i + 1 >= argc)
+        {
+            throw std::string("Error: missing value for option \"" + arg + "\"");
+        }
+
+        const char *val = argv[++i];
+
+        if (arg == "-o")
+        {
+            params.outFile = val;
+        }
+        else if (arg == "-n")
+        {
+            params.numProcesses = strtoul(val, NULL, 10);
+        }
+        else if (arg == "-s")
+        {
+            params.seed = strtoul(val, NULL, 10);
+        }
+        else if (arg == "-cpu")
+        {
+            params.cpuMean = strtod(val, NULL);
+        }
+        else if (arg == "-io")
+        {
+            params.ioRate = strtod(val, NULL);
+        }
+        else if (arg == "-iocycles")
+        {
+            params.ioMean = strtod(val, NULL);
+        }
+        else if (arg == "-mem")
+        {
+            params.memProb = strtod(val, NULL);
+        }
+        else if (arg == "-alpha")
+        {
+            params.alpha = strtod(val, NULL);
+        }
+        else if (arg == "-bursts")
+        {
+            char *sep;
+            params.minBursts = strtoul(val, &sep, 10);
+            params.maxBursts = (*sep == ':') ? strtoul(sep + 1, NULL, 10) : params.minBursts;
+        }
+        else if (arg == "-tickets")
+        {
+            params.maxTickets = strtoul(val, NULL, 10);
+        }
+        else
+        {
+            throw std::string("Error: unknown option \"" + arg + "\"");
+        }
+    }
+
+    // the Poisson mean of I/O operations must be positive, and -mem is a 
+    // probability
+    if (params.cpuMean <= 0.0 || params.ioMean <= 0.0 || params.alpha <= 0.0 || 
+        params.ioRate <= 0.0 || params.memProb < 0.0 || params.memProb > 1.0 || 
+        params.minBursts == 0 || params.maxBursts < params.minBursts)
+    {
+        throw std::string("Error: invalid workload parameters");
+    }
+
+    return params;
+}
+
+/**
+ * @brief      Generates the workload and writes it to a stream.
+ *
+ * @param[in]  params  The generation parameters
+ * @param      out     The output stream
+ */
+void generateWorkload(const genParams &params, std::ostream &out)
+{
+    std::mt19937_64 eng(params.seed);
+    std::exponential_distribution<double> cpuDistr(1.0 / params.cpuMean);
+    std::exponential_distribution<double> ioCycleDistr(1.0 / params.ioMean);
+    std::poisson_distribution<unsigned> ioCountDistr(params.ioRate);
+    std::uniform_real_distribution<double> unitDistr(0.0, 1.0);
+    std::uniform_int_distribution<unsigned> ioTypeDistr(0, 5);
+    std::uniform_int_distribution<unsigned> memTypeDistr(0, 1);
+    std::uniform_int_distribution<unsigned long> ticketDistr(1, std::max(1UL, params.maxTickets));
+    InstructionWriter writer(out);
+
+    out << "Start Program Meta-Data Code:\n";
+    writer.write("S{begin}", 0);
+
+    for (unsigned long p = 0; p < params.numProcesses; p++)
+    {
+        // bounded Pareto via inverse transform sampling
+        double u = unitDistr(eng);
+        double ratio = (double) params.minBursts / params.maxBursts;
+        double bursts = params.minBursts / 
+            std::pow(1.0 - u * (1.0 - std::pow(ratio, params.alpha)), 1.0 / params.alpha);
+        unsigned long numBursts = std::min(params.maxBursts, 
+                                           (unsigned long) std::ceil(bursts - 1e-9));
+
+        writer.write("A{begin}", params.maxTickets ? ticketDistr(eng) : 0);
+
+        for (unsigned long b = 0; b < numBursts; b++)
+        {
+            writer.write("P{run}", (unsigned long) std::ceil(cpuDistr(eng)));
+
+            for (unsigned n = ioCountDistr(eng); n > 0; n--)
+            {
+                writer.write(IO_INSTRUCTIONS[ioTypeDistr(eng)], 
+                             (unsigned long) std::ceil(ioCycleDistr(eng)));
+            }
+
+            if (unitDistr(eng) < params.memProb)
+            {
+                writer.write(MEM_INSTRUCTIONS[memTypeDistr(eng)], 
+                             (unsigned long) std::ceil(ioCycleDistr(eng)));
+            }
+        }
+
+        writer.write("A{finish}", 0);
+    }
+
+    writer.finish();
+    out << "End Program Meta-Data Code.\n";
+}
@@ -0,0 +1,152 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file pickbench.cpp
+ *
+ * @brief Next-process selection microbenchmark for the OS Simulator
+ *
+ * @details Fills a PCBTable with 10^3 to 10^6 processes with random
+ *          instruction counts, makes two of every three ready, and times the
+ *          SJF (smallest key) and PS (largest key) next-process searches. 
+ *          The FIFO (lowest pid) search is timed at its worst, with only the 
+ *          last process ready. The SJF and PS search compiled into 
+ *          PCBTable.cpp (scalar, SSE2 or AVX2) depends on the build flags; the
+ *          "bench" make target builds all three.
+ *
+ * @version 1.01
+ *          Adam Landis (19 October 2026)
+ *          Time FIFO picks
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note None
+ */
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: pickbench
+ *
+ * Prints one line per table size with the mean time of one FIFO, one SJF and
+ * one PS pick in microseconds.
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout
+#include <iomanip>      // setw, setprecision
+#include <random>       // key and state draws
+
+#include "PCB.h"
+#include "PCBTable.h"
+#include "Timer.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+//
+const unsigned long BENCH_SEED = 446;
+const unsigned long KEYS_PER_SIZE = 100000000;  // keys scanned per table size
+const unsigned MIN_PICKS = 10;
+const unsigned MAX_KEY = 100000;
+#if SIM_SIMD && defined(__AVX2__)
+const char *SEARCH_NAME = "AVX2";
+#elif SIM_SIMD && defined(__SSE2__)
+const char *SEARCH_NAME = "SSE2";
+#else
+const char *SEARCH_NAME = "scalar";
+#endif
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+double timePicks(const PCBTable &table, PCBKey key, bool isMax,
+                 unsigned picks, unsigned long &checksum);
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main()
+{
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<unsigned> keyDistr(1, MAX_KEY);
+    std::uniform_int_distribution<unsigned> stateDistr(0, 2);
+    unsigned long checksum = 0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "pick-next (" << SEARCH_NAME << ")\n"
+              << std::setw(12) << "Processes" << std::setw(12) << "FIFO (us)"
+              << std::setw(12) << "SJF (us)"
+              << std::setw(12) << "PS (us)" << "\n";
+
+    for (unsigned numProcesses = 1000; numProcesses <= 1000000; numProcesses *= 10)
+    {
+        PCBTable table;
+        unsigned picks = KEYS_PER_SIZE / numProcesses;
+
+        if (picks < MIN_PICKS)
+        {
+            picks = MIN_PICKS;
+        }
+
+        for (unsigned i = 0; i < numProcesses; i++)
+        {
+            PCB pcb(i + 1, keyDistr(gen), keyDistr(gen));
+
+            pcb.setState(stateDistr(gen) == 0 ? WAIT : READY);
+            table.add(pcb);
+        }
+
+        double sjfUs = timePicks(table, KEY_NUM_INSTR, false, picks, checksum);
+        double psUs = timePicks(table, KEY_NUM_IO_INSTR, true, picks, checksum);
+
+        for (unsigned i = 0; i + 1 < numProcesses; i++)
+        {
+            table.setState(i, WAIT);
+        }
+
+        table.setState(numProcesses - 1, READY);
+
+        double fifoUs = timePicks(table, KEY_PID, false, picks, checksum);
+
+        std::cout << std::setw(12) << numProcesses << std::setw(12) << fifoUs
+                  << std::setw(12) << sjfUs
+                  << std::setw(12) << psUs << "\n";
+    }
+
+    // printed so that the picks cannot be optimized away
+    std::cout << "checksum " << checksum << std::endl;
+
+    return 0;
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Times repeated next-process picks on a table.
+ *
+ * @param[in]  table     The table
+ * @param[in]  key       The key to compare
+ * @param[in]  isMax     True to pick the largest key, false for the smallest
+ * @param[in]  picks     The number of picks to time
+ * @param      checksum  The sum of the picked indices
+ *
+ * @return     The mean time of one pick (us)
+ */
+double timePicks(const PCBTable &table, PCBKey key, bool isMax,
+                 unsigned picks, unsigned long &checksum)
+{
+    Timer timer;
+    unsigned idx = 0;
+
+    timer.startTimer();
+
+    for (unsigned p = 0; p < picks; p++)
+    {
+        if (isMax ? table.pickMax(key, idx) : table.pickMin(key, idx))
+        {
+            checksum += idx;
+        }
+    }
+
+    timer.stopTimer();
+
+    return timer.getDuration() * 1000.0 / picks;
+}
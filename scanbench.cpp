@@ -0,0 +1,167 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file scanbench.cpp
+ *
+ * @brief Metadata tokenizer microbenchmark for the OS Simulator
+ *
+ * @details Generates a meta-data body in memory and measures the rate in MB/s
+ *          at which it is split into instruction tokens, both by the original
+ *          byte-at-a-time tokenizer and by the MetadataScanner. The classifier
+ *          compiled into MetadataScanner.cpp (scalar, SSE2 or AVX2) depends on
+ *          the build flags; the "bench" make target builds all three.
+ *
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note None
+ */
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: scanbench
+ *
+ * Prints the tokenizing rate of both tokenizers and the number of tokens
+ * each found.
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout
+#include <iomanip>      // setw, setprecision
+#include <string>       // string
+#include <vector>       // tokens
+#include <random>       // instruction draws
+
+#include "MetadataScanner.h"
+#include "Timer.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+//
+const unsigned long BENCH_SEED = 446;
+const size_t BODY_SIZE = 32 << 20;
+const unsigned REPETITIONS = 5;
+const unsigned INSTRUCTIONS_PER_LINE = 8;
+const char *INSTRUCTIONS[] = {
+    "P{run}", "P{run}", "P{run}", "I{hard drive}", "O{hard drive}",
+    "I{keyboard}", "I{scanner}", "O{monitor}", "O{projector}", "M{allocate}",
+    "M{block}"
+};
+#if SIM_SIMD && defined(__AVX2__)
+const char *SCAN_NAME = "AVX2";
+#elif SIM_SIMD && defined(__SSE2__)
+const char *SCAN_NAME = "SSE2";
+#else
+const char *SCAN_NAME = "scalar";
+#endif
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+std::string genBody(size_t size);
+size_t baselineTokenize(const std::string &body);
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main()
+{
+    std::string body = genBody(BODY_SIZE);
+    double sizeMB = body.length() / 1048576.0;
+    size_t baselineTokens = 0;
+    std::vector<metadataToken> tokens;
+    Timer baselineTimer, scanTimer;
+
+    baselineTimer.startTimer();
+
+    for (unsigned r = 0; r < REPETITIONS; r++)
+    {
+        baselineTokens = baselineTokenize(body);
+    }
+
+    baselineTimer.stopTimer();
+    scanTimer.startTimer();
+
+    for (unsigned r = 0; r < REPETITIONS; r++)
+    {
+        MetadataScanner scanner;
+
+        tokens.clear();
+        scanner.scan(body.data(), body.length(), tokens);
+    }
+
+    scanTimer.stopTimer();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "tokenizer (" << SCAN_NAME << "), " << sizeMB << " MB\n"
+              << std::setw(16) << "Tokenizer" << std::setw(12) << "MB/s"
+              << std::setw(12) << "Tokens" << "\n"
+              << std::setw(16) << "byte-at-a-time"
+              << std::setw(12) << sizeMB * REPETITIONS * 1000.0 / baselineTimer.getDuration()
+              << std::setw(12) << baselineTokens << "\n"
+              << std::setw(16) << "MetadataScanner"
+              << std::setw(12) << sizeMB * REPETITIONS * 1000.0 / scanTimer.getDuration()
+              << std::setw(12) << tokens.size() << std::endl;
+
+    return 0;
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Generates a meta-data body of ';'-terminated instructions in the
+ *             layout written by mdgen.
+ *
+ * @param[in]  size  The minimum size of the body (bytes)
+ *
+ * @return     The body
+ */
+std::string genBody(size_t size)
+{
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<unsigned> instrDistr(0, sizeof(INSTRUCTIONS) / sizeof(INSTRUCTIONS[0]) - 1);
+    std::uniform_int_distribution<unsigned> cycleDistr(1, 99);
+    std::string body;
+    unsigned long count = 0;
+
+    body.reserve(size + 64);
+
+    while (body.length() < size)
+    {
+        body += INSTRUCTIONS[instrDistr(gen)];
+        body += std::to_string(cycleDistr(gen));
+        body += ';';
+        body += (++count % INSTRUCTIONS_PER_LINE == 0) ? '\n' : ' ';
+    }
+
+    return body;
+}
+
+/**
+ * @brief      Splits a body into instructions one byte at a time, copying the
+ *             characters other than whitespace of each instruction, as the
+ *             parser did before the MetadataScanner.
+ *
+ * @param[in]  body  The body
+ *
+ * @return     The number of instructions
+ */
+size_t baselineTokenize(const std::string &body)
+{
+    std::string tempInstr;
+    size_t count = 0;
+
+    for (char c: body)
+    {
+        if (c == ';')
+        {
+            count += !tempInstr.empty();
+            tempInstr.clear();
+        }
+        else if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+        {
+            tempInstr += c;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,98 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file simlog.cpp
+ *
+ * @brief Binary event log decoder for the OS Simulator
+ *
+ * @details Reads a log file written with "Log Format: Binary" and prints the
+ *          text log the simulator would have written with "Log Format: Text",
+ *          byte for byte.
+ *
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note None
+ */
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: simlog <binary log file> [-o <text log file>]
+ *
+ *   -o <file>          write the text log to <file> (default: standard output)
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout, cerr
+#include <fstream>      // ifstream, ofstream
+#include <sstream>      // ostringstream
+#include <string>       // string
+
+#include "EventLog.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+//
+const size_t SIMLOG_FLUSH_BYTES = 1 << 20;      // decoded text held at once
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main(int argc, char *argv[])
+{
+    try
+    {
+        EventLog events;
+        std::ostringstream contents;
+        std::ofstream outFile;
+        std::ostream *out = &std::cout;
+        std::string in, text;
+        size_t pos = 0;
+
+        if (argc != 2 && !(argc == 4 && std::string(argv[2]) == "-o"))
+        {
+            throw std::string("Usage: simlog <binary log file> [-o <text log file>]");
+        }
+
+        std::ifstream inFile(argv[1], std::ios::in | std::ios::binary);
+
+        if (!inFile)
+        {
+            throw std::string("Error: log file \"" + std::string(argv[1]) + "\" does not exist");
+        }
+
+        contents << inFile.rdbuf();
+        in = contents.str();
+
+        if (argc == 4)
+        {
+            outFile.open(argv[3], std::ios::out | std::ios::binary);
+
+            if (!outFile)
+            {
+                throw std::string("Error: cannot open output file \"" + std::string(argv[3]) + "\"");
+            }
+
+            out = &outFile;
+        }
+
+        while (events.decode(in, pos, text))
+        {
+            if (text.size() >= SIMLOG_FLUSH_BYTES)
+            {
+                out->write(text.data(), text.size());
+                text.clear();
+            }
+        }
+
+        out->write(text.data(), text.size());
+        out->flush();
+    }
+    catch (std::string& e)
+    {
+        std::cerr << e << std::endl;
+        exit(1);
+    }
+
+    return 0;
+}
+//
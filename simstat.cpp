@@ -0,0 +1,136 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file simstat.cpp
+ *
+ * @brief Live statistics viewer for the OS Simulator
+ *
+ * @details Reads the memory-mapped stats file published by a running 
+ *          simulator (sim4 --stats-file) and prints its latest snapshot, once
+ *          or repeatedly until the run finishes.
+ * 
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note None
+ */ 
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: simstat <stats file> [-w <msec>]
+ *
+ *   -w <msec>          print a snapshot every <msec> milliseconds until the 
+ *                      run finishes (default: print once)
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout, cerr
+#include <sstream>      // ostringstream
+#include <iomanip>      // setw, setprecision
+#include <string>       // string
+#include <cstdlib>      // strtoul
+#include <unistd.h>     // usleep
+
+#include "LiveStats.h"
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+std::string formatSnapshot(const liveSnapshot &snap);
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main(int argc, char *argv[])
+{
+    try
+    {
+        LiveStats stats;
+        liveSnapshot snap;
+        unsigned long intervalMs = 0;
+
+        if (argc != 2 && !(argc == 4 && std::string(argv[2]) == "-w"))
+        {
+            throw std::string("Usage: simstat <stats file> [-w <msec>]");
+        }
+
+        if (argc == 4)
+        {
+            intervalMs = strtoul(argv[3], NULL, 10);
+        }
+
+        stats.open(argv[1]);
+
+        while (true)
+        {
+            if (!stats.read(snap))
+            {
+                std::cout << "No snapshot published yet\n";
+            }
+            else
+            {
+                std::cout << formatSnapshot(snap);
+            }
+
+            std::cout.flush();
+
+            if (intervalMs == 0 || snap.finished)
+            {
+                break;
+            }
+
+            usleep(intervalMs * 1000);
+        }
+    }
+    catch (std::string& e)
+    {
+        std::cerr << e << std::endl;
+        exit(1);
+    }
+
+    return 0;
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Formats a snapshot for display.
+ *
+ * @param[in]  snap  The snapshot
+ *
+ * @return     The formatted snapshot
+ */
+std::string formatSnapshot(const liveSnapshot &snap)
+{
+    std::ostringstream out;
+
+    out << std::fixed << std::setprecision(6);
+    out << "sim4 pid " << snap.writerPid 
+        << (snap.finished ? " (finished)" : " (running)") << "\n";
+    out << "Simulation time   " << snap.clockUs / 1000000.0 << " s\n";
+    out << "Wall time         " << snap.wallUs / 1000000.0 << " s\n";
+    out << "Instructions      " << snap.instructions << "\n";
+    out << "Processes         " << snap.completed << "/" << snap.numProcesses 
+        << " completed, " << snap.ready << " ready, " << snap.waiting 
+        << " waiting\n";
+    out << "Memory in use     " << snap.memInUse << "/" << snap.sysMem 
+        << " kbytes\n";
+    out << std::setprecision(3);
+    out << std::left << std::setw(14) << "Device" << std::right 
+        << std::setw(8) << "Busy" 
+        << std::setw(12) << "Ops" 
+        << std::setw(14) << "Time (ms)" << "\n";
+
+    for (unsigned d = 0; d < NUM_DEVICES; d++)
+    {
+        out << std::left << std::setw(14) << DEVICE_NAMES[d] << std::right 
+            << std::setw(8) << std::to_string(snap.busyUnits[d]) + "/" + 
+                               std::to_string(snap.totalUnits[d])
+            << std::setw(12) << snap.deviceOps[d]
+            << std::setw(14) << snap.deviceTimeUs[d] / 1000.0 << "\n";
+    }
+
+    out << "\n";
+
+    return out.str();
+}
@@ -0,0 +1,180 @@
+// Program Information /////////////////////////////////////////////////////////
+
+/**
+ * @file taskbench.cpp
+ *
+ * @brief Coroutine process microbenchmark for the OS Simulator
+ *
+ * @details Creates one ProcessTask coroutine per simulated process, resumes
+ *          each of them until it finishes, suspending SUSPENSIONS times on
+ *          the way, and reports the memory of the frames and the cost of one
+ *          resume/suspend. For comparison, it also times the pthread
+ *          create/join pair that the thread build spends on each I/O
+ *          instruction.
+ *
+ * @version 1.00
+ *          Adam Landis (19 October 2026)
+ *          Initial development
+ *
+ * @note Only built with -DSIM_COROUTINES=1 and C++20 (see the "bench" make
+ *       target).
+ */
+
+// Program Description/Support /////////////////////////////////////////////////
+/*
+ * Usage: taskbench [processes]
+ *
+ *   processes          number of coroutines (default: 1000000)
+ */
+// Header Files ////////////////////////////////////////////////////////////////
+//
+#include <iostream>     // cout, cerr
+#include <iomanip>      // setprecision
+#include <vector>       // tasks
+#include <string>       // string
+#include <cstdlib>      // strtoul
+#include <pthread.h>    // pthread_create, pthread_join
+#include <sys/resource.h> // getrusage
+
+#include "ProcessTask.h"
+#include "Timer.h"
+//
+// Global Constant Definitions /////////////////////////////////////////////////
+//
+const unsigned long DEFAULT_PROCESSES = 1000000;
+const unsigned SUSPENSIONS = 10;
+const unsigned THREAD_PAIRS = 1000;
+//
+// Free Function Prototypes ////////////////////////////////////////////////////
+//
+ProcessTask runProcess(unsigned long &steps);
+void* emptyThread(void* param);
+long peakRssKB();
+//
+// Main Function Implementation ////////////////////////////////////////////////
+//
+int main(int argc, char *argv[])
+{
+    unsigned long numProcesses = DEFAULT_PROCESSES;
+    unsigned long steps = 0;
+
+    if (argc > 1)
+    {
+        numProcesses = strtoul(argv[1], NULL, 10);
+    }
+
+    if (numProcesses == 0)
+    {
+        std::cerr << "Error: invalid number of processes" << std::endl;
+        return 1;
+    }
+
+    std::vector<ProcessTask> tasks;
+    Timer createTimer, resumeTimer, threadTimer;
+
+    tasks.reserve(numProcesses);
+
+    long rssBefore = peakRssKB();
+
+    createTimer.startTimer();
+
+    for (unsigned long p = 0; p < numProcesses; p++)
+    {
+        tasks.push_back(runProcess(steps));
+    }
+
+    createTimer.stopTimer();
+
+    long rssAfter = peakRssKB();
+
+    // round robin over all processes, as the dispatcher resumes them
+    resumeTimer.startTimer();
+
+    for (unsigned s = 0; s <= SUSPENSIONS; s++)
+    {
+        for (ProcessTask &task: tasks)
+        {
+            task.resume();
+        }
+    }
+
+    resumeTimer.stopTimer();
+    threadTimer.startTimer();
+
+    for (unsigned t = 0; t < THREAD_PAIRS; t++)
+    {
+        pthread_t tid;
+
+        if (pthread_create(&tid, NULL, emptyThread, NULL) != 0)
+        {
+            std::cerr << "Error: unable to create thread" << std::endl;
+            return 1;
+        }
+
+        pthread_join(tid, NULL);
+    }
+
+    threadTimer.stopTimer();
+
+    double resumes = (double) numProcesses * (SUSPENSIONS + 1);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "coroutines: " << numProcesses << " processes, "
+              << SUSPENSIONS << " suspensions each\n"
+              << "Frames: " << (rssAfter - rssBefore) / 1024.0 << " MB ("
+              << (rssAfter - rssBefore) * 1024.0 / numProcesses << " bytes per process)\n"
+              << "Create: " << createTimer.getDuration() * 1.0e6 / numProcesses << " ns per process\n"
+              << "Resume/suspend: " << resumeTimer.getDuration() * 1.0e6 / resumes << " ns\n"
+              << "pthread create/join: " << threadTimer.getDuration() * 1.0e3 / THREAD_PAIRS << " us\n"
+              << "steps " << steps << std::endl;
+
+    return 0;
+}
+//
+// Free Function Implementation ////////////////////////////////////////////////
+//
+
+/**
+ * @brief      Coroutine of one process, which suspends as if it waited for
+ *             I/O SUSPENSIONS times.
+ *
+ * @param      steps  The count of steps of all processes
+ *
+ * @return     The task
+ */
+ProcessTask runProcess(unsigned long &steps)
+{
+    for (unsigned s = 0; s < SUSPENSIONS; s++)
+    {
+        steps++;
+        co_await std::suspend_always();
+    }
+
+    steps++;
+}
+
+/**
+ * @brief      Thread that returns at once.
+ *
+ * @param      param  Unused
+ *
+ * @return     None
+ */
+void* emptyThread(void* param)
+{
+    return param;
+}
+
+/**
+ * @brief      Gets the peak resident memory of the program.
+ *
+ * @return     The peak resident memory (KB)
+ */
+long peakRssKB()
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}